@@ -0,0 +1,303 @@
+// Checks that the operator lookups of mathML/nsMathMLOperators.cpp make no
+// allocation: they run for every <mo> on each reflow, on any thread.
+//
+// Build it with nsMathMLOperators.cpp against the object directory OBJDIR
+// of a Gecko build, under any MATHML_OPERATOR_LAYOUT and with or without
+// the other options of nsMathMLOperators.cpp, from the root of this tree:
+//	c++ -std=c++17 -include $OBJDIR/mozilla-config.h -I$OBJDIR/dist/include
+//		-I$OBJDIR/dist/include/nspr -ImathML -o TestOperatorAllocations
+//		TestOperatorAllocations.cpp mathML/nsMathMLOperators.cpp
+//		-L$OBJDIR/dist/bin -lxul -lmozglue -lnspr4
+// or with TestOperatorAllocations.vcxproj, whose GeckoObjDir property is
+// OBJDIR.
+// It prints the allocations made by each entry point, and fails if there
+// are any. It also fails if the lookups do not return the attributes
+// mathfont.properties gives a few operators, or if LookupOperatorBatch
+// does not find what LookupOperator finds for each string.
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <vector>
+#include "nsString.h"
+#include "nsMathMLOperators.h"
+
+using namespace std;
+
+static atomic<bool> gCounting(false);
+static atomic<uint32_t> gAllocations(0);
+
+static void
+CountAllocation()
+{
+	if (gCounting.load(memory_order_relaxed))
+		gAllocations.fetch_add(1, memory_order_relaxed);
+}
+
+// On glibc, an allocation through operator new is counted twice, once
+// more by malloc below; only zero matters here.
+void* operator new(size_t aSize)
+{
+	CountAllocation();
+	if (void* p = malloc(aSize ? aSize : 1))
+		return p;
+	throw bad_alloc();
+}
+
+void* operator new[](size_t aSize)
+{
+	return operator new(aSize);
+}
+
+void* operator new(size_t aSize, const nothrow_t&) noexcept
+{
+	CountAllocation();
+	return malloc(aSize ? aSize : 1);
+}
+
+void* operator new[](size_t aSize, const nothrow_t& aNothrow) noexcept
+{
+	return operator new(aSize, aNothrow);
+}
+
+void operator delete(void* aPtr) noexcept { free(aPtr); }
+void operator delete[](void* aPtr) noexcept { free(aPtr); }
+void operator delete(void* aPtr, size_t) noexcept { free(aPtr); }
+void operator delete[](void* aPtr, size_t) noexcept { free(aPtr); }
+
+#if defined(__GLIBC__)
+// malloc as well, for the allocations that do not go through operator new
+extern "C" void* __libc_malloc(size_t aSize);
+extern "C" void* __libc_calloc(size_t aCount, size_t aSize);
+extern "C" void* __libc_realloc(void* aPtr, size_t aSize);
+
+extern "C" void* malloc(size_t aSize)
+{
+	CountAllocation();
+	return __libc_malloc(aSize);
+}
+
+extern "C" void* calloc(size_t aCount, size_t aSize)
+{
+	CountAllocation();
+	return __libc_calloc(aCount, aSize);
+}
+
+extern "C" void* realloc(void* aPtr, size_t aSize)
+{
+	CountAllocation();
+	return __libc_realloc(aPtr, aSize);
+}
+#endif
+
+// Allocations made by aLookups
+template<typename Lookups>
+static uint32_t
+CountAllocations(Lookups aLookups)
+{
+	gAllocations = 0;
+	gCounting = true;
+	aLookups();
+	gCounting = false;
+	return gAllocations;
+}
+
+// strings looked up besides every BMP code point: compound operators and
+// words around them
+static const char16_t* const kCompound[] = {
+	u"!=", u"&&", u"->", u"...", u"++", u"||", u":=", u"<=", u"sin", u"lim", u"max", u"!==",
+	u"!===", u"\u219B", u"\u222B\u222B"
+};
+
+// what LookupOperatorBatch returns for each string
+static bool gFound[0xFFFF + size(kCompound)];
+
+// What mathfont.properties gives some strings under a form, the fallback
+// to another form included
+static const struct {
+	const char16_t*	str;
+	nsOperatorFlags	form;
+	bool			found;
+	nsOperatorFlags	foundForm;
+	float			leadingSpace;
+	float			trailingSpace;
+	nsOperatorFlags	flags;	// that must be set too
+} kExpected[] = {
+	{ u"+", NS_MATHML_OPERATOR_FORM_INFIX, true, NS_MATHML_OPERATOR_FORM_INFIX, 4, 4, 0 },
+	{ u"+", NS_MATHML_OPERATOR_FORM_PREFIX, true, NS_MATHML_OPERATOR_FORM_PREFIX, 0, 1, 0 },
+	{ u"+", NS_MATHML_OPERATOR_FORM_POSTFIX, true, NS_MATHML_OPERATOR_FORM_INFIX, 4, 4, 0 },
+	{ u"(", NS_MATHML_OPERATOR_FORM_INFIX, true, NS_MATHML_OPERATOR_FORM_PREFIX, 0, 0,
+		NS_MATHML_OPERATOR_STRETCHY | NS_MATHML_OPERATOR_FENCE },
+	{ u"!=", NS_MATHML_OPERATOR_FORM_PREFIX, true, NS_MATHML_OPERATOR_FORM_INFIX, 4, 4, 0 },
+	{ u"\u2211", NS_MATHML_OPERATOR_FORM_POSTFIX, true, NS_MATHML_OPERATOR_FORM_PREFIX, 1, 2,
+		NS_MATHML_OPERATOR_LARGEOP | NS_MATHML_OPERATOR_MOVABLELIMITS },
+	{ u"sin", NS_MATHML_OPERATOR_FORM_INFIX, false, 0, 0, 0, 0 },
+	{ u"!===", NS_MATHML_OPERATOR_FORM_INFIX, false, 0, 0, 0, 0 }
+};
+
+// LookupOperator<Form> with aForm as Form
+static bool
+LookupOperatorForm(const nsString& aOperator, nsOperatorFlags aForm,
+	nsOperatorFlags* aFlags, float* aLeadingSpace, float* aTrailingSpace)
+{
+	switch (aForm) {
+	case NS_MATHML_OPERATOR_FORM_INFIX:
+		return nsMathMLOperators::LookupOperator<NS_MATHML_OPERATOR_FORM_INFIX>(aOperator,
+			aFlags, aLeadingSpace, aTrailingSpace);
+	case NS_MATHML_OPERATOR_FORM_PREFIX:
+		return nsMathMLOperators::LookupOperator<NS_MATHML_OPERATOR_FORM_PREFIX>(aOperator,
+			aFlags, aLeadingSpace, aTrailingSpace);
+	default:
+		return nsMathMLOperators::LookupOperator<NS_MATHML_OPERATOR_FORM_POSTFIX>(aOperator,
+			aFlags, aLeadingSpace, aTrailingSpace);
+	}
+}
+
+// Entries of kExpected that the entry points do not return
+static uint32_t
+CountWrongResults()
+{
+	uint32_t wrong = 0;
+	for (uint32_t i = 0; i < size(kExpected); ++i) {
+		const auto& expected = kExpected[i];
+		nsString str;
+		str.Assign(expected.str);
+		for (int entryPoint = 0; entryPoint < 3; ++entryPoint) {
+			nsOperatorFlags flags = 0;
+			float leadingSpace = 0.0f, trailingSpace = 0.0f;
+			bool found =
+				entryPoint == 0 ? nsMathMLOperators::LookupOperator(str, expected.form,
+					&flags, &leadingSpace, &trailingSpace) :
+				entryPoint == 1 ? nsMathMLOperators::LookupOperator(str.get(), str.Length(),
+					expected.form, &flags, &leadingSpace, &trailingSpace) :
+				LookupOperatorForm(str, expected.form, &flags, &leadingSpace, &trailingSpace);
+			if (found != expected.found || (found &&
+					(NS_MATHML_OPERATOR_GET_FORM(flags) != expected.foundForm ||
+					 leadingSpace != expected.leadingSpace ||
+					 trailingSpace != expected.trailingSpace ||
+					 (flags & expected.flags) != expected.flags))) {
+				printf("kExpected[%u]: wrong result of entry point %d\n", i, entryPoint);
+				++wrong;
+			}
+		}
+
+		// LookupOperators only reports the forms that are listed
+		nsOperatorFlags allFlags[4];
+		float allLeadingSpace[4], allTrailingSpace[4];
+		nsMathMLOperators::LookupOperators(str, allFlags, allLeadingSpace, allTrailingSpace);
+		nsOperatorFlags listed = expected.found ? allFlags[expected.foundForm] : 0;
+		if (expected.found != (listed != 0) || (listed &&
+				(NS_MATHML_OPERATOR_GET_FORM(listed) != expected.foundForm ||
+				 allLeadingSpace[expected.foundForm] != expected.leadingSpace ||
+				 allTrailingSpace[expected.foundForm] != expected.trailingSpace))) {
+			printf("kExpected[%u]: wrong result of LookupOperators\n", i);
+			++wrong;
+		}
+	}
+	return wrong;
+}
+
+// Strings for which LookupOperatorBatch does not find what LookupOperator
+// finds, under any layout or option it is built with
+static uint32_t
+CountBatchMismatches(const vector<nsString>& aOperators, const vector<nsOperatorFlags>& aForms)
+{
+	uint32_t count = static_cast<uint32_t>(aOperators.size());
+	vector<nsOperatorFlags> flags(count);
+	vector<float> leadingSpace(count), trailingSpace(count);
+	nsMathMLOperators::LookupOperatorBatch(aOperators.data(), aForms.data(), count,
+		flags.data(), leadingSpace.data(), trailingSpace.data(), gFound);
+	uint32_t mismatches = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		nsOperatorFlags oneFlags = 0;
+		float oneLeadingSpace = 0.0f, oneTrailingSpace = 0.0f;
+		bool found = nsMathMLOperators::LookupOperator(aOperators[i], aForms[i],
+			&oneFlags, &oneLeadingSpace, &oneTrailingSpace);
+		if (found != gFound[i] || (found && (oneFlags != flags[i] ||
+				oneLeadingSpace != leadingSpace[i] || oneTrailingSpace != trailingSpace[i])))
+			++mismatches;
+	}
+	return mismatches;
+}
+
+int main()
+{
+	// The strings are built before counting, as nsString may allocate.
+	vector<nsString> operators;
+	for (uint32_t c = 1; c < 0x10000; ++c) {
+		char16_t code = static_cast<char16_t>(c);
+		operators.emplace_back();
+		operators.back().Assign(&code, 1);
+	}
+	for (const char16_t* str : kCompound) {
+		operators.emplace_back();
+		operators.back().Assign(str);
+	}
+	uint32_t count = static_cast<uint32_t>(operators.size());
+	vector<nsOperatorFlags> forms(count), flags(count);
+	vector<float> leadingSpace(count), trailingSpace(count);
+	for (uint32_t i = 0; i < count; ++i)
+		forms[i] = NS_MATHML_OPERATOR_FORM_INFIX + i % 3;
+	nsOperatorFlags allFlags[4];
+	float allLeadingSpace[4], allTrailingSpace[4];
+
+	// Thread-local storage emulated by the compiler (MinGW, Android before
+	// API level 29) allocates the variables of a thread on their first
+	// access, such as the lookup cache of MATHML_OPERATOR_LOOKUP_CACHE.
+	// That is not a lookup allocating, so take it before counting.
+	nsMathMLOperators::LookupOperator(operators[0], forms[0], &flags[0], &leadingSpace[0], &trailingSpace[0]);
+
+	const struct {
+		const char*	name;
+		uint32_t	allocations;
+	} results[] = {
+		{ "LookupOperator(nsString)", CountAllocations([&] {
+			for (uint32_t i = 0; i < count; ++i)
+				nsMathMLOperators::LookupOperator(operators[i], forms[i],
+					&flags[i], &leadingSpace[i], &trailingSpace[i]);
+		}) },
+		{ "LookupOperator(char16_t*, length)", CountAllocations([&] {
+			for (uint32_t i = 0; i < count; ++i)
+				nsMathMLOperators::LookupOperator(operators[i].get(), operators[i].Length(), forms[i],
+					&flags[i], &leadingSpace[i], &trailingSpace[i]);
+		}) },
+		{ "LookupOperator<Form>", CountAllocations([&] {
+			for (uint32_t i = 0; i < count; ++i) {
+				nsMathMLOperators::LookupOperator<NS_MATHML_OPERATOR_FORM_INFIX>(operators[i],
+					&flags[i], &leadingSpace[i], &trailingSpace[i]);
+				nsMathMLOperators::LookupOperator<NS_MATHML_OPERATOR_FORM_PREFIX>(operators[i],
+					&flags[i], &leadingSpace[i], &trailingSpace[i]);
+				nsMathMLOperators::LookupOperator<NS_MATHML_OPERATOR_FORM_POSTFIX>(operators[i].get(),
+					operators[i].Length(), &flags[i], &leadingSpace[i], &trailingSpace[i]);
+			}
+		}) },
+		{ "LookupOperators", CountAllocations([&] {
+			for (uint32_t i = 0; i < count; ++i)
+				nsMathMLOperators::LookupOperators(operators[i], allFlags, allLeadingSpace, allTrailingSpace);
+		}) },
+		{ "LookupOperatorBatch", CountAllocations([&] {
+			nsMathMLOperators::LookupOperatorBatch(operators.data(), forms.data(), count,
+				flags.data(), leadingSpace.data(), trailingSpace.data(), gFound);
+		}) }
+	};
+
+	int failures = 0;
+	for (const auto& result : results) {
+		printf("%-36s %u allocations\n", result.name, result.allocations);
+		if (result.allocations)
+			++failures;
+	}
+
+	uint32_t wrong = CountWrongResults();
+	printf("%-36s %u wrong results\n", "expected attributes", wrong);
+	if (wrong)
+		++failures;
+
+	uint32_t mismatches = CountBatchMismatches(operators, forms);
+	printf("%-36s %u mismatches\n", "LookupOperatorBatch/LookupOperator", mismatches);
+	if (mismatches)
+		++failures;
+	return failures ? 1 : 0;
+}
@@ -10,11 +10,99 @@ OperatorData operatorTable[SIZE]{
 #include <iostream>
 #include <fstream>
 #include <vector>
-#include <regex>
 #include <sstream>
+#include <iomanip>
 #include <algorithm>
 #include <map>
+#include <array>
+#include <string_view>
+#include <cstring>
+#include <cstddef>
+#include <cctype>
+#include <cstdlib>
+#include <cmath>
+#include <thread>
+#include <chrono>
+#include <random>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "main.h"
+#include "mathML/nsMathMLOperatorLookup.h"
+
+// Read-only memory mapping of a whole input file.
+// The properties file is scanned in place, so no per-line copies are made.
+class MappedFile {
+public:
+	explicit MappedFile(const char* aPath)
+		: mData(nullptr),
+		mSize(0)
+	{
+#ifdef _WIN32
+		mFile = CreateFileA(aPath, GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		mMapping = nullptr;
+		if (mFile == INVALID_HANDLE_VALUE)
+			return;
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(mFile, &size) || 0 == size.QuadPart)
+			return;
+		mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mMapping)
+			return;
+		mData = static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+		if (mData)
+			mSize = static_cast<size_t>(size.QuadPart);
+#else
+		mFd = open(aPath, O_RDONLY);
+		if (mFd < 0)
+			return;
+		struct stat st;
+		if (fstat(mFd, &st) != 0 || 0 == st.st_size)
+			return;
+		void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, mFd, 0);
+		if (data == MAP_FAILED)
+			return;
+		mData = static_cast<const char*>(data);
+		mSize = static_cast<size_t>(st.st_size);
+#endif
+	}
+
+	~MappedFile()
+	{
+#ifdef _WIN32
+		if (mData) UnmapViewOfFile(mData);
+		if (mMapping) CloseHandle(mMapping);
+		if (mFile != INVALID_HANDLE_VALUE) CloseHandle(mFile);
+#else
+		if (mData) munmap(const_cast<char*>(mData), mSize);
+		if (mFd >= 0) close(mFd);
+#endif
+	}
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* begin() const { return mData; }
+	const char* end() const { return mData + mSize; }
+	size_t size() const { return mSize; }
+
+private:
+	const char*	mData;
+	size_t		mSize;
+#ifdef _WIN32
+	HANDLE		mFile;
+	HANDLE		mMapping;
+#else
+	int			mFd;
+#endif
+};
 
 void
 SetBooleanProperty(OperatorData* aOperatorData, string aName)
@@ -76,8 +164,8 @@ SetProperty(OperatorData* aOperatorData, string aName, string aValue)
 static bool
 SetOperator(OperatorData*   aOperatorData,
 	nsOperatorFlags			aForm,
-	string&					aOperator,
-	string&					aAttributes,
+	string_view				aOperator,
+	string_view				aAttributes,
 	string&					comment)
 
 {
@@ -146,7 +234,7 @@ SetOperator(OperatorData*   aOperatorData,
 			++it;
 		}
 		// If ':' is not found, then it's a boolean property
-		bool IsBooleanProperty = (kColonCh != *it);
+		bool IsBooleanProperty = (it == aAttributes.end()) || (kColonCh != *it);
 		if (IsBooleanProperty) {
 			SetBooleanProperty(aOperatorData, name);
 		}
@@ -159,10 +247,10 @@ SetOperator(OperatorData*   aOperatorData,
 			}
 			SetProperty(aOperatorData, name, value);
 		}
-		++it;
+		if (it != aAttributes.end()) ++it;
 	}
 	// If reached '#', extract comment
-	if ((kDashCh == *it))
+	if ((it != aAttributes.end()) && (kDashCh == *it))
 	{
 		++it;	// skip dash
 		for (; it != aAttributes.end(); ++it)
@@ -173,126 +261,2153 @@ SetOperator(OperatorData*   aOperatorData,
 }
 
 
-int main()
+typedef pair<OperatorData, vector<string>> TableRow;
+
+// Matches the key of a line of the form
+//	operator.\uNNNN[\uNNNN...].{infix,postfix,prefix} = attributes
+// On success aOperator holds the \uNNNN sequence and aAttributes everything
+// that follows the space after the key.
+static bool
+ScanOperatorKey(const char* aLine, const char* aLineEnd,
+	string_view& aOperator, nsOperatorFlags& aForm, string_view& aAttributes)
 {
-	ifstream inFile("mathfont.properties");
-	ofstream outFile("operatorTableCode.txt");
-	vector<pair<OperatorData, vector<string>>> compoundRows, rows;
-	int compoundCount = 0, count = 0;
-	while (inFile) {
-		string line;
-		getline(inFile, line);
-		if (line[0] == '#' || line[0] == ' ') continue;
-		// Get operator and attributes separated
-		regex reg("operator.\\S*\\ ");
-		smatch match;
-		regex_search(line, match, reg);
-		string name = match.str(0);
-		// remove match length chars from beginning of line
-		string attributes = line.substr(name.length(), line.length() - name.length());
-		///cout << " " << name.size() << " " << name << " " << attributes << endl;
-		// expected key: operator.\uNNNN.{infix,postfix,prefix}
-		if ((21 <= name.length()) && (0 == name.find("operator.\\u"))) {
-			name.erase(0, 9); // 9 is the length of "operator.";
-			name.pop_back();  // remove ' '
-			int32_t len = name.length();
-			nsOperatorFlags form = 0;
-			if (name.find(".infix")!=string::npos) {
-				form = NS_MATHML_OPERATOR_FORM_INFIX;
-				len -= 6;  // 6 is the length of ".infix";
-			}
-			else if (name.find(".postfix")!=string::npos) {
-				form = NS_MATHML_OPERATOR_FORM_POSTFIX;
-				len -= 8; // 8 is the length of ".postfix";
-			}
-			else if (name.find(".prefix")!=string::npos) {
-				form = NS_MATHML_OPERATOR_FORM_PREFIX;
-				len -= 7; // 7 is the length of ".prefix";
-			}
-			else continue; // input is not applicable
-			// remove form
-			name = name.substr(0, len );
+	static const char kPrefix[] = "operator.\\u";
+	const size_t prefixLength = sizeof(kPrefix) - 1;
+	if (static_cast<size_t>(aLineEnd - aLine) < prefixLength
+		|| memcmp(aLine, kPrefix, prefixLength))
+		return false;
+
+	// key runs up to the first whitespace, which must be a space
+	const char* keyEnd = aLine + prefixLength;
+	while (keyEnd < aLineEnd && !isspace(static_cast<unsigned char>(*keyEnd)))
+		++keyEnd;
+	if (keyEnd == aLineEnd || *keyEnd != ' ')
+		return false;
+	// 21 is the length of "operator.\uNNNN.infix", the shortest valid key
+	if (keyEnd - aLine < 21)
+		return false;
+
+	string_view key(aLine + 9, keyEnd - aLine - 9); // 9 is the length of "operator."
+	static const struct {
+		string_view		suffix;
+		nsOperatorFlags	form;
+	} kForms[] = {
+		{ ".infix", NS_MATHML_OPERATOR_FORM_INFIX },
+		{ ".postfix", NS_MATHML_OPERATOR_FORM_POSTFIX },
+		{ ".prefix", NS_MATHML_OPERATOR_FORM_PREFIX }
+	};
+	for (const auto& form : kForms) {
+		if (key.size() > form.suffix.size()
+			&& 0 == key.compare(key.size() - form.suffix.size(), form.suffix.size(), form.suffix)) {
+			aOperator = key.substr(0, key.size() - form.suffix.size());
+			aForm = form.form;
+			aAttributes = string_view(keyEnd + 1, aLineEnd - keyEnd - 1);
+			return true;
+		}
+	}
+	return false; // input is not applicable
+}
+
+// Spells out the dictionary bits of aFlags, e.g.
+//	NS_MATHML_OPERATOR_FORM_PREFIX | NS_MATHML_OPERATOR_FENCE
+static string
+FlagsExpression(nsOperatorFlags aFlags)
+{
+	static const struct {
+		nsOperatorFlags	flag;
+		const char*		name;
+	} kProperties[] = {
+		{ NS_MATHML_OPERATOR_STRETCHY, "NS_MATHML_OPERATOR_STRETCHY" },
+		{ NS_MATHML_OPERATOR_FENCE, "NS_MATHML_OPERATOR_FENCE" },
+		{ NS_MATHML_OPERATOR_ACCENT, "NS_MATHML_OPERATOR_ACCENT" },
+		{ NS_MATHML_OPERATOR_LARGEOP, "NS_MATHML_OPERATOR_LARGEOP" },
+		{ NS_MATHML_OPERATOR_SEPARATOR, "NS_MATHML_OPERATOR_SEPARATOR" },
+		{ NS_MATHML_OPERATOR_MOVABLELIMITS, "NS_MATHML_OPERATOR_MOVABLELIMITS" },
+		{ NS_MATHML_OPERATOR_SYMMETRIC, "NS_MATHML_OPERATOR_SYMMETRIC" },
+		{ NS_MATHML_OPERATOR_INTEGRAL, "NS_MATHML_OPERATOR_INTEGRAL" },
+		{ NS_MATHML_OPERATOR_MIRRORABLE, "NS_MATHML_OPERATOR_MIRRORABLE" }
+	};
+	string expression;
+	nsOperatorFlags form = NS_MATHML_OPERATOR_GET_FORM(aFlags);
+	if (form == NS_MATHML_OPERATOR_FORM_INFIX)
+		expression = "NS_MATHML_OPERATOR_FORM_INFIX";
+	else if (form == NS_MATHML_OPERATOR_FORM_PREFIX)
+		expression = "NS_MATHML_OPERATOR_FORM_PREFIX";
+	else if (form == NS_MATHML_OPERATOR_FORM_POSTFIX)
+		expression = "NS_MATHML_OPERATOR_FORM_POSTFIX";
+	if (aFlags & NS_MATHML_OPERATOR_DIRECTION_HORIZONTAL)
+		expression += " | NS_MATHML_OPERATOR_DIRECTION_HORIZONTAL";
+	if (aFlags & NS_MATHML_OPERATOR_DIRECTION_VERTICAL)
+		expression += " | NS_MATHML_OPERATOR_DIRECTION_VERTICAL";
+	for (const auto& property : kProperties) {
+		if (aFlags & property.flag)
+			expression += string(" | ") + property.name;
+	}
+	return expression;
+}
+
+// Builds the table row for one parsed operator
+static TableRow
+MakeRow(const OperatorData& aOperatorData, string_view aOperator, const string& aComment)
+{
+	// the direction is not part of the NS_LITERAL_STRING rows
+	nsOperatorFlags flags = aOperatorData.mFlags & ~NS_MATHML_OPERATOR_DIRECTION;
+	stringstream ss;
+	ss << "{ NS_LITERAL_STRING(\""<< aOperator << "\"), " << int(aOperatorData.mTrailingSpace) 
+		<< ", " << int(aOperatorData.mLeadingSpace) << ", " << FlagsExpression(flags) << " ";
+	return make_pair(aOperatorData, vector<string>{ ss.str(), aComment });
+}
+
+// Parses every line in [aBegin, aEnd) with a single forward scan
+// and appends the resulting rows to the matching table.
+static void
+ParseLines(const char* aBegin, const char* aEnd,
+	vector<TableRow>& rows, vector<TableRow>& compoundRows)
+{
+	const char* line = aBegin;
+	while (line < aEnd) {
+		const char* lineEnd = static_cast<const char*>(memchr(line, '\n', aEnd - line));
+		if (!lineEnd) lineEnd = aEnd;
+		const char* next = lineEnd + 1;
+		// CRLF line ends, as in a checkout with core.autocrlf
+		if (lineEnd > line && lineEnd[-1] == '\r')
+			--lineEnd;
 
+		string_view name, attributes;
+		nsOperatorFlags form = 0;
+		if (ScanOperatorKey(line, lineEnd, name, form, attributes)) {
 			string comment = "";
-			OperatorData dummyData;
-			OperatorData* operatorData = &dummyData;
+			OperatorData operatorData;
 
 			// If the operator should be retained
 			//	construct row for table
-			if (SetOperator(operatorData, form, name, attributes, comment)) {
-				bool prev = 0;
-				stringstream ss;
-				ss << "{ NS_LITERAL_STRING(\""<< name << "\"), " << int(operatorData->mTrailingSpace) 
-					<< ", " << int(operatorData->mLeadingSpace) << ", ";
-				if (form == NS_MATHML_OPERATOR_FORM_INFIX)
-					ss << "NS_MATHML_OPERATOR_FORM_INFIX ";
-				else if (form == NS_MATHML_OPERATOR_FORM_PREFIX)
-					ss << "NS_MATHML_OPERATOR_FORM_PREFIX ";
-				else if (form == NS_MATHML_OPERATOR_FORM_POSTFIX)
-					ss << "NS_MATHML_OPERATOR_FORM_POSTFIX ";
-				if (operatorData->mFlags & NS_MATHML_OPERATOR_STRETCHY) {
-					ss << "| NS_MATHML_OPERATOR_STRETCHY ";
-					prev = 1;
-				}
-				if (operatorData->mFlags & NS_MATHML_OPERATOR_FENCE) {
-					ss << "| NS_MATHML_OPERATOR_FENCE ";
-				}
-				if(operatorData->mFlags & NS_MATHML_OPERATOR_ACCENT) {
-					ss << "| NS_MATHML_OPERATOR_ACCENT ";
-				}
-				if(operatorData->mFlags & NS_MATHML_OPERATOR_LARGEOP) {
-					ss << "| NS_MATHML_OPERATOR_LARGEOP ";
-				}
-				if(operatorData->mFlags & NS_MATHML_OPERATOR_SEPARATOR) {
-					ss << "| NS_MATHML_OPERATOR_SEPARATOR ";
-				}
-				if(operatorData->mFlags & NS_MATHML_OPERATOR_MOVABLELIMITS) {
-					ss << "| NS_MATHML_OPERATOR_MOVABLELIMITS ";
-				}
-				if(operatorData->mFlags & NS_MATHML_OPERATOR_SYMMETRIC) {
-					ss << "| NS_MATHML_OPERATOR_SYMMETRIC ";
-				}
-				if(operatorData->mFlags & NS_MATHML_OPERATOR_INTEGRAL) {
-					ss << "| NS_MATHML_OPERATOR_INTEGRAL ";
-				}
-				if(operatorData->mFlags & NS_MATHML_OPERATOR_MIRRORABLE) {
-					ss << "| NS_MATHML_OPERATOR_MIRRORABLE ";
-				}
-				vector<string> s{ ss.str(), comment };
+			if (SetOperator(&operatorData, form, name, attributes, comment)) {
 				// If compound operator: save row for compound operator table
-				if (name.length() > 6) {
-					++compoundCount;
-					compoundRows.push_back(make_pair(*operatorData, s ));
+				if (name.length() > 6)
+					compoundRows.push_back(MakeRow(operatorData, name, comment));
+				else
+					rows.push_back(MakeRow(operatorData, name, comment));
+			}
+		}
+		line = next;
+	}
+}
+
+// Splits [aBegin, aEnd) into at most aCount chunks of roughly equal size.
+// Every chunk except the last ends just after a '\n', so no line is split.
+static vector<pair<const char*, const char*>>
+SplitLines(const char* aBegin, const char* aEnd, unsigned aCount)
+{
+	vector<pair<const char*, const char*>> chunks;
+	size_t chunkSize = (aEnd - aBegin) / aCount + 1;
+	const char* chunk = aBegin;
+	while (chunk < aEnd) {
+		const char* chunkEnd = chunk + chunkSize;
+		if (chunkEnd >= aEnd)
+			chunkEnd = aEnd;
+		else {
+			chunkEnd = static_cast<const char*>(memchr(chunkEnd, '\n', aEnd - chunkEnd));
+			chunkEnd = chunkEnd ? chunkEnd + 1 : aEnd;
+		}
+		chunks.push_back(make_pair(chunk, chunkEnd));
+		chunk = chunkEnd;
+	}
+	return chunks;
+}
+
+// Parses [aBegin, aEnd) on aThreads threads.
+// Each chunk gets its own row buffers, which are appended in chunk order
+// afterwards, so the rows reach the sort exactly as ParseLines leaves them.
+static void
+ParseLinesParallel(const char* aBegin, const char* aEnd, unsigned aThreads,
+	vector<TableRow>& rows, vector<TableRow>& compoundRows)
+{
+	vector<pair<const char*, const char*>> chunks = SplitLines(aBegin, aEnd, aThreads);
+	if (chunks.size() <= 1) {
+		ParseLines(aBegin, aEnd, rows, compoundRows);
+		return;
+	}
+
+	vector<vector<TableRow>> chunkRows(chunks.size()), chunkCompoundRows(chunks.size());
+	vector<thread> workers;
+	for (size_t i = 1; i < chunks.size(); ++i) {
+		workers.emplace_back(ParseLines, chunks[i].first, chunks[i].second,
+			ref(chunkRows[i]), ref(chunkCompoundRows[i]));
+	}
+	// the calling thread takes the first chunk
+	ParseLines(chunks[0].first, chunks[0].second, chunkRows[0], chunkCompoundRows[0]);
+	for (auto& worker : workers)
+		worker.join();
+
+	for (size_t i = 0; i < chunks.size(); ++i) {
+		rows.insert(end(rows), make_move_iterator(begin(chunkRows[i])),
+			make_move_iterator(end(chunkRows[i])));
+		compoundRows.insert(end(compoundRows), make_move_iterator(begin(chunkCompoundRows[i])),
+			make_move_iterator(end(chunkCompoundRows[i])));
+	}
+}
+
+// Writes one code unit as a C++ hex literal, e.g. 0x221E
+static string
+CodeUnitLiteral(char16_t aCodeUnit)
+{
+	stringstream ss;
+	ss << "0x" << hex << uppercase << setw(4) << setfill('0') << int(aCodeUnit);
+	return ss.str();
+}
+
+static void
+WriteGeneratedHeader(ostream& aOut, const char* aLayout)
+{
+	aOut << "// Generated by GenerateOperatorTable --layout=" << aLayout
+		<< " from mathfont.properties." << endl
+		<< "// Do not edit; regenerate instead." << endl << endl;
+}
+
+// Writes aRows as the initializer of a constexpr OperatorData array:
+//	{ { key code units }, key length, lspace, rspace, flags }
+// The key is stored inline, so the table has no pointers to relocate
+// and no constructor to run.
+static void
+WriteConstexprRows(ostream& aOut, const vector<TableRow>& aRows)
+{
+	for (size_t i = 0; i < aRows.size(); ++i) {
+		const OperatorData& data = aRows[i].first;
+		aOut << "\t{ { ";
+		for (size_t j = 0; j < data.mStr.size(); ++j)
+			aOut << (j ? ", " : "") << CodeUnitLiteral(data.mStr[j]);
+		aOut << " }, " << data.mStr.size() << ", " << int(data.mLeadingSpace) << ", "
+			<< int(data.mTrailingSpace) << ", " << FlagsExpression(data.mFlags)
+			<< (i + 1 < aRows.size() ? " }, //" : " } //") << aRows[i].second[1] << endl;
+	}
+}
+
+static size_t
+MaxKeyLength(const vector<TableRow>& aRows)
+{
+	size_t length = 0;
+	for (const auto& row : aRows)
+		length = max(length, row.first.mStr.size());
+	return length;
+}
+
+// --layout=constexpr
+// gOperatorTable and gCompoundOperTable as POD arrays for nsMathMLOperators.cpp
+static void
+EmitConstexprTables(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	WriteGeneratedHeader(aOut, "constexpr");
+	aOut << "static_assert(kMaxOperatorLength >= " << MaxKeyLength(compoundRows)
+		<< ", \"operator keys do not fit OperatorData::mStr\");" << endl << endl;
+	aOut << "static constexpr uint16_t gOperatorCount = " << rows.size() << ";" << endl;
+	aOut << "static constexpr uint16_t gCompoundOperCount = " << compoundRows.size() << ";" << endl << endl;
+	aOut << "static constexpr OperatorData gOperatorTable[gOperatorCount] = {" << endl;
+	WriteConstexprRows(aOut, rows);
+	aOut << "};" << endl << endl;
+	aOut << "static constexpr OperatorData gCompoundOperTable[gCompoundOperCount] = {" << endl;
+	WriteConstexprRows(aOut, compoundRows);
+	aOut << "};" << endl;
+}
+
+// Minimal perfect hash over the (code point, form) keys of the single
+// character rows, see OperatorHashSlot in nsMathMLOperatorLookup.h
+struct OperatorHashLayout {
+	uint32_t			salt;
+	vector<uint16_t>	seeds;	// one per bucket
+	vector<size_t>		slots;	// row index of each slot
+};
+
+// Hash and displace: buckets are placed largest first, each with the first
+// seed that sends all of its keys to free slots. If some bucket has no
+// such seed, start over with another salt.
+// Returns false if two rows have the same key, as no seed separates them.
+static bool
+BuildOperatorHash(const vector<TableRow>& rows, OperatorHashLayout& hash)
+{
+	uint32_t slotCount = static_cast<uint32_t>(rows.size());
+	uint32_t bucketCount = max(1u, (slotCount + 3) / 4);
+	vector<uint32_t> keys;
+	for (const auto& row : rows)
+		keys.push_back(OperatorHashKey(row.first.mStr[0], NS_MATHML_OPERATOR_GET_FORM(row.first.mFlags)));
+	vector<size_t> byKey(keys.size());
+	for (size_t i = 0; i < byKey.size(); ++i)
+		byKey[i] = i;
+	sort(begin(byKey), end(byKey), [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+	auto duplicate = adjacent_find(begin(byKey), end(byKey),
+		[&](size_t a, size_t b) { return keys[a] == keys[b]; });
+	if (duplicate != end(byKey)) {
+		cerr << "operator" << rows[*duplicate].second[1] << " is listed twice with the same form" << endl;
+		return false;
+	}
+
+	for (hash.salt = 0; ; hash.salt += 0x10000) {
+		vector<vector<size_t>> buckets(bucketCount);
+		for (size_t i = 0; i < keys.size(); ++i)
+			buckets[OperatorHashBucket(keys[i], hash.salt, bucketCount)].push_back(i);
+		vector<uint32_t> order(bucketCount);
+		for (uint32_t i = 0; i < bucketCount; ++i)
+			order[i] = i;
+		stable_sort(begin(order), end(order), [&](uint32_t a, uint32_t b) {
+			return buckets[a].size() > buckets[b].size();
+		});
+
+		hash.seeds.assign(bucketCount, 0);
+		hash.slots.assign(slotCount, SIZE_MAX);
+		bool placed = true;
+		for (uint32_t bucket : order) {
+			if (buckets[bucket].empty())
+				break;
+			uint32_t seed = 1;
+			for (; seed <= UINT16_MAX; ++seed) {
+				vector<uint32_t> taken;
+				for (size_t row : buckets[bucket]) {
+					uint32_t slot = OperatorHashReduce(OperatorHash(keys[row], hash.salt + seed), slotCount);
+					if (hash.slots[slot] != SIZE_MAX || find(begin(taken), end(taken), slot) != end(taken))
+						break;
+					taken.push_back(slot);
 				}
-				else {
-					++count;
-					rows.push_back(make_pair(*operatorData, s ));
+				if (taken.size() == buckets[bucket].size()) {
+					for (size_t i = 0; i < taken.size(); ++i)
+						hash.slots[taken[i]] = buckets[bucket][i];
+					break;
 				}
 			}
+			if (seed > UINT16_MAX) {
+				placed = false;
+				break;
+			}
+			hash.seeds[bucket] = static_cast<uint16_t>(seed);
 		}
+		if (placed)
+			return true;
 	}
+}
 
-	// Sort tables
-	sort(begin(rows), end(rows));
-	sort(begin(compoundRows), end(compoundRows));
+// --layout=hash
+// gOperatorTable reordered by hash slot, plus the seeds to find the slots
+static void
+EmitOperatorHash(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>&)
+{
+	WriteGeneratedHeader(aOut, "hash");
+	OperatorHashLayout hash;
+	if (!BuildOperatorHash(rows, hash)) {
+		aOut << "#error \"the Operator Dictionary has duplicate keys\"" << endl;
+		return;
+	}
+	vector<TableRow> slotRows;
+	for (size_t row : hash.slots)
+		slotRows.push_back(rows[row]);
 
-	// Output tables to file
-	for (int i = 0; i < rows.size(); ++i)
-	{
-		outFile << rows[i].second[0];
-		if (i < rows.size() - 1) outFile << "}, //";
-		else outFile << "} //";
-		outFile << rows[i].second[1] << endl;
+	aOut << "static constexpr uint32_t gOperatorHashSalt = " << hash.salt << ";" << endl;
+	aOut << "static constexpr uint32_t gOperatorHashBucketCount = " << hash.seeds.size() << ";" << endl << endl;
+	aOut << "static constexpr uint16_t gOperatorHashSeeds[gOperatorHashBucketCount] = {";
+	for (size_t i = 0; i < hash.seeds.size(); ++i)
+		aOut << (i % 16 ? " " : "\n\t") << hash.seeds[i] << (i + 1 < hash.seeds.size() ? "," : "");
+	aOut << endl << "};" << endl << endl;
+	aOut << "static constexpr OperatorData gOperatorHashTable[" << slotRows.size() << "] = {" << endl;
+	WriteConstexprRows(aOut, slotRows);
+	aOut << "};" << endl;
+}
+
+// Two-level page table over the single character rows,
+// see OperatorPageEntry in nsMathMLOperatorLookup.h
+struct OperatorPageTable {
+	vector<uint8_t>								index;	// page of each high byte
+	vector<array<uint16_t, kOperatorPageSize>>	pages;
+};
+
+static OperatorPageTable
+BuildOperatorPageTable(const vector<TableRow>& rows)
+{
+	OperatorPageTable table;
+	table.index.assign(256, 0);
+	table.pages.emplace_back();	// the shared empty page
+	table.pages.back().fill(0);
+	for (size_t i = 0; i < rows.size(); ++i) {
+		char16_t c = rows[i].first.mStr[0];
+		if (i > 0 && rows[i - 1].first.mStr[0] == c)
+			continue; // not the first form of c
+		if (0 == table.index[c >> 8]) {
+			table.index[c >> 8] = static_cast<uint8_t>(table.pages.size());
+			table.pages.emplace_back();
+			table.pages.back().fill(0);
+		}
+		table.pages[table.index[c >> 8]][c & 0xFF] = static_cast<uint16_t>(i + 1);
 	}
-	outFile << "};" << endl << endl;
-	for (int i = 0; i < compoundRows.size(); ++i)
-	{
-		outFile << compoundRows[i].second[0];
-		if (i < compoundRows.size() - 1) outFile << "}, //";
-		else outFile << "} //";
-		outFile << compoundRows[i].second[1] << endl;
+	return table;
+}
+
+// --layout=pagetable
+// Page table indexing gOperatorTable by code point
+static void
+EmitOperatorPageTable(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>&)
+{
+	OperatorPageTable table = BuildOperatorPageTable(rows);
+	WriteGeneratedHeader(aOut, "pagetable");
+	aOut << "// " << table.pages.size() << " pages, "
+		<< table.index.size() + table.pages.size() * sizeof(table.pages[0]) << " bytes" << endl << endl;
+	aOut << "static constexpr uint8_t gOperatorPageIndex[256] = {";
+	for (size_t i = 0; i < table.index.size(); ++i)
+		aOut << (i % 16 ? " " : "\n\t") << int(table.index[i]) << (i + 1 < table.index.size() ? "," : "");
+	aOut << endl << "};" << endl << endl;
+	aOut << "static constexpr uint16_t gOperatorPages[" << table.pages.size()
+		<< "][kOperatorPageSize] = {" << endl;
+	for (size_t page = 0; page < table.pages.size(); ++page) {
+		aOut << "\t{";
+		for (size_t i = 0; i < kOperatorPageSize; ++i)
+			aOut << (i % 16 ? " " : "\n\t\t") << table.pages[page][i] << (i + 1 < kOperatorPageSize ? "," : "");
+		aOut << endl << (page + 1 < table.pages.size() ? "\t}," : "\t}") << endl;
+	}
+	aOut << "};" << endl;
+}
+
+// Writes a key column, 32 bytes of keys per line
+template<typename Key>
+static void
+WriteKeyColumn(ostream& aOut, const char* aType, const char* aName,
+	const char* aCount, const vector<Key>& aKeys)
+{
+	aOut << "static constexpr " << aType << " " << aName << "[" << aCount << "] = {";
+	for (size_t i = 0; i < aKeys.size(); ++i) {
+		aOut << (i % (32 / sizeof(Key)) ? " " : "\n\t") << "0x" << hex << uppercase << setfill('0')
+			<< setw(2 * sizeof(Key)) << uint64_t(aKeys[i]) << dec << (i + 1 < aKeys.size() ? "," : "");
+	}
+	aOut << endl << "};" << endl << endl;
+}
+
+// Writes the flags and spacing columns parallel to a key column
+static void
+WriteAttributeColumns(ostream& aOut, const char* aPrefix, const char* aCount,
+	const vector<TableRow>& aRows)
+{
+	aOut << "static constexpr uint16_t " << aPrefix << "Flags[" << aCount << "] = {" << endl;
+	for (size_t i = 0; i < aRows.size(); ++i) {
+		aOut << "\t" << FlagsExpression(aRows[i].first.mFlags)
+			<< (i + 1 < aRows.size() ? ", //" : " //") << aRows[i].second[1] << endl;
+	}
+	aOut << "};" << endl << endl;
+	// lspace in the low nibble, rspace in the high nibble
+	aOut << "static constexpr uint8_t " << aPrefix << "Spacing[" << aCount << "] = {";
+	for (size_t i = 0; i < aRows.size(); ++i) {
+		const OperatorData& data = aRows[i].first;
+		aOut << (i % 16 ? " " : "\n\t") << "0x" << hex << uppercase << int(data.mTrailingSpace)
+			<< int(data.mLeadingSpace) << dec << (i + 1 < aRows.size() ? "," : "");
+	}
+	aOut << endl << "};" << endl << endl;
+}
+
+static vector<uint16_t>
+SingleKeys(const vector<TableRow>& rows)
+{
+	vector<uint16_t> keys;
+	for (const auto& row : rows)
+		keys.push_back(row.first.mStr[0]);
+	return keys;
+}
+
+static vector<uint64_t>
+CompoundKeys(const vector<TableRow>& compoundRows)
+{
+	vector<uint64_t> keys;
+	for (const auto& row : compoundRows) {
+		const u16string& str = row.first.mStr;
+		keys.push_back(OperatorCompoundKey(str.data(), static_cast<uint32_t>(str.size())));
+	}
+	return keys;
+}
+
+// --layout=columns
+// Struct-of-arrays tables: dense sorted key columns, searched on their own,
+// and flags and spacing columns that are only read for the row found
+static void
+EmitOperatorColumns(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	WriteGeneratedHeader(aOut, "columns");
+	aOut << "static_assert(kMaxPackedOperatorLength >= " << MaxKeyLength(compoundRows)
+		<< ", \"operator keys do not fit OperatorCompoundKey\");" << endl << endl;
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorKeys", "gOperatorCount", SingleKeys(rows));
+	WriteKeyColumn(aOut, "uint64_t", "gCompoundOperKeys", "gCompoundOperCount", CompoundKeys(compoundRows));
+	WriteAttributeColumns(aOut, "gOperator", "gOperatorCount", rows);
+	WriteAttributeColumns(aOut, "gCompoundOper", "gCompoundOperCount", compoundRows);
+}
+
+// Places sorted keys in Eytzinger order, see OperatorEytzingerLowerBound.
+// aRows receives the sorted index of each node; node 0 is padding.
+template<typename Key>
+static vector<Key>
+EytzingerOrder(const vector<Key>& aSorted, vector<uint16_t>& aRows)
+{
+	vector<Key> keys(aSorted.size() + 1, 0);
+	aRows.assign(aSorted.size() + 1, 0);
+	// in-order walk of the implicit tree visits the nodes in sorted order
+	size_t next = 0;
+	vector<size_t> stack;
+	size_t k = 1;
+	while (k < keys.size() || !stack.empty()) {
+		if (k < keys.size()) {
+			stack.push_back(k);
+			k = 2 * k;
+		}
+		else {
+			k = stack.back();
+			stack.pop_back();
+			keys[k] = aSorted[next];
+			aRows[k] = static_cast<uint16_t>(next++);
+			k = 2 * k + 1;
+		}
+	}
+	return keys;
+}
+
+// --layout=eytzinger
+// Key columns in Eytzinger order, each node mapped back to its row in
+// the sorted columns of --layout=columns
+static void
+EmitOperatorEytzinger(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	vector<uint16_t> singleRows, compoundNodeRows;
+	vector<uint16_t> singleKeys = EytzingerOrder(SingleKeys(rows), singleRows);
+	vector<uint64_t> compoundKeys = EytzingerOrder(CompoundKeys(compoundRows), compoundNodeRows);
+	WriteGeneratedHeader(aOut, "eytzinger");
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorEytzingerKeys", "gOperatorCount + 1", singleKeys);
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorEytzingerRows", "gOperatorCount + 1", singleRows);
+	WriteKeyColumn(aOut, "uint64_t", "gCompoundOperEytzingerKeys", "gCompoundOperCount + 1", compoundKeys);
+	WriteKeyColumn(aOut, "uint16_t", "gCompoundOperEytzingerRows", "gCompoundOperCount + 1", compoundNodeRows);
+}
+
+// --layout=simd
+// The single character key column in blocks for OperatorBlockSearch,
+// with the last key of each block; rows are those of --layout=columns
+static vector<uint16_t>
+BlockedKeys(const vector<TableRow>& rows, vector<uint16_t>& aLastKeys)
+{
+	vector<uint16_t> keys = SingleKeys(rows);
+	aLastKeys.clear();
+	for (size_t i = kOperatorKeyBlock; i < keys.size() + kOperatorKeyBlock; i += kOperatorKeyBlock)
+		aLastKeys.push_back(keys[min(i, keys.size()) - 1]);
+	keys.resize(aLastKeys.size() * kOperatorKeyBlock, 0xFFFF);
+	return keys;
+}
+
+static void
+EmitOperatorBlocks(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>&)
+{
+	vector<uint16_t> lastKeys;
+	vector<uint16_t> keys = BlockedKeys(rows, lastKeys);
+
+	WriteGeneratedHeader(aOut, "simd");
+	aOut << "static constexpr uint32_t gOperatorBlockCount = " << lastKeys.size() << ";" << endl << endl;
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorBlockLastKeys", "gOperatorBlockCount", lastKeys);
+	aOut << "alignas(32) ";
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorBlockedKeys", "gOperatorBlockCount * kOperatorKeyBlock", keys);
+}
+
+// error bound of the model of --layout=learned, in rows, set with
+// --learned-error=
+static uint32_t gLearnedMaxError = 4;
+
+// Piecewise-linear model of the first row of each single character key
+// of --layout=columns, see OperatorLearnedSearch
+struct OperatorLearnedModel {
+	vector<uint16_t>	keys;	// of the segments
+	vector<uint16_t>	rows;
+	vector<uint32_t>	slopes;
+	uint32_t			maxError;
+	size_t				pointCount;	// distinct keys
+};
+
+// Segments are grown greedily: a segment ends when no slope keeps all
+// its keys within the error bound.
+static OperatorLearnedModel
+FitOperatorLearned(const vector<TableRow>& rows)
+{
+	vector<uint16_t> keys = SingleKeys(rows);
+	// the distinct keys and their first rows
+	vector<uint16_t> pointKeys, pointRows;
+	for (size_t i = 0; i < keys.size(); ++i) {
+		if (0 == i || keys[i] != keys[i - 1]) {
+			pointKeys.push_back(keys[i]);
+			pointRows.push_back(static_cast<uint16_t>(i));
+		}
+	}
+
+	vector<uint16_t> segmentKeys, segmentRows;
+	vector<uint32_t> slopes;
+	vector<size_t> segments;	// segment of each point
+	const double bound = gLearnedMaxError;
+	for (size_t first = 0; first < pointKeys.size();) {
+		// the slopes, in rows per code point, that fit the points so far
+		double low = 0, high = HUGE_VAL;
+		size_t end = first + 1;
+		for (; end < pointKeys.size(); ++end) {
+			double dk = pointKeys[end] - pointKeys[first];
+			double dr = double(pointRows[end]) - pointRows[first];
+			double newLow = max(low, (dr - bound) / dk), newHigh = min(high, (dr + bound) / dk);
+			if (newLow > newHigh)
+				break;
+			low = newLow;
+			high = newHigh;
+		}
+		double slope = high == HUGE_VAL ? low : (low + high) / 2;
+		segmentKeys.push_back(pointKeys[first]);
+		segmentRows.push_back(pointRows[first]);
+		slopes.push_back(static_cast<uint32_t>(llround(slope * 65536)));
+		segments.insert(segments.end(), end - first, segmentKeys.size() - 1);
+		first = end;
+	}
+	// the fixed point slopes may round a prediction one row further
+	uint32_t maxError = 0;
+	for (size_t i = 0; i < pointKeys.size(); ++i) {
+		size_t s = segments[i];
+		uint32_t predicted = OperatorLearnedPredict(segmentKeys[s], segmentRows[s], slopes[s], pointKeys[i]);
+		maxError = max(maxError, predicted > pointRows[i] ? predicted - pointRows[i] : pointRows[i] - predicted);
+	}
+	return { segmentKeys, segmentRows, slopes, maxError, pointKeys.size() };
+}
+
+// --layout=learned
+// The model of FitOperatorLearned
+static void
+EmitOperatorLearned(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>&)
+{
+	OperatorLearnedModel model = FitOperatorLearned(rows);
+	WriteGeneratedHeader(aOut, "learned");
+	aOut << "// " << model.pointCount << " operators in " << model.keys.size() << " segments, "
+		<< model.keys.size() * (2 * sizeof(uint16_t) + sizeof(uint32_t)) << " bytes" << endl << endl;
+	aOut << "static constexpr uint32_t gOperatorLearnedSegmentCount = " << model.keys.size() << ";" << endl;
+	aOut << "static constexpr uint32_t gOperatorLearnedMaxError = " << model.maxError << ";" << endl << endl;
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorLearnedKeys", "gOperatorLearnedSegmentCount", model.keys);
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorLearnedRows", "gOperatorLearnedSegmentCount", model.rows);
+	WriteKeyColumn(aOut, "uint32_t", "gOperatorLearnedSlopes", "gOperatorLearnedSegmentCount", model.slopes);
+}
+
+// Character trie over the compound rows, see OperatorTrieWalk
+struct OperatorTrie {
+	vector<OperatorTrieNode>	nodes;
+	vector<char16_t>			labels;	// code unit leading to each node
+	vector<size_t>				rows;	// compound row of each trie row
+};
+
+// Returns false if the trie does not fit OperatorTrieNode: more than
+// UINT8_MAX children or rows at a node, or more than UINT16_MAX nodes or rows.
+static bool
+BuildOperatorTrie(const vector<TableRow>& compoundRows, OperatorTrie& trie)
+{
+	struct BuildNode {
+		map<char16_t, size_t>	children;
+		vector<size_t>			rows;
+	};
+	vector<BuildNode> tree(1);
+	for (size_t row = 0; row < compoundRows.size(); ++row) {
+		size_t node = 0;
+		for (char16_t c : compoundRows[row].first.mStr) {
+			auto child = tree[node].children.find(c);
+			if (child == tree[node].children.end()) {
+				tree[node].children[c] = tree.size();
+				node = tree.size();
+				tree.emplace_back();
+			}
+			else node = child->second;
+		}
+		// rows are sorted, so the forms of a key arrive in order of preference
+		tree[node].rows.push_back(row);
+	}
+
+	if (tree.size() > UINT16_MAX || compoundRows.size() > UINT16_MAX) {
+		cerr << "the compound operators need " << tree.size() << " trie nodes and "
+			<< compoundRows.size() << " rows, more than " << UINT16_MAX << endl;
+		return false;
+	}
+
+	// number the nodes breadth first
+	vector<size_t> queue(1, 0);
+	trie.labels.push_back(0);
+	for (size_t i = 0; i < queue.size(); ++i) {
+		const BuildNode& node = tree[queue[i]];
+		if (node.children.size() > UINT8_MAX || node.rows.size() > UINT8_MAX) {
+			cerr << "trie node " << i << " has " << node.children.size() << " children and "
+				<< node.rows.size() << " rows, more than " << UINT8_MAX << endl;
+			return false;
+		}
+		OperatorTrieNode flat;
+		flat.mFirstChild = static_cast<uint16_t>(queue.size());
+		flat.mChildCount = static_cast<uint8_t>(node.children.size());
+		flat.mFirstRow = static_cast<uint16_t>(trie.rows.size());
+		flat.mRowCount = static_cast<uint8_t>(node.rows.size());
+		for (const auto& child : node.children) {
+			queue.push_back(child.second);
+			trie.labels.push_back(child.first);
+		}
+		trie.rows.insert(end(trie.rows), begin(node.rows), end(node.rows));
+		trie.nodes.push_back(flat);
+	}
+	return true;
+}
+
+// --layout=trie
+// Compound operators as a character trie with its own attribute rows,
+// so keys of any length are found in one pass over their code units
+static void
+EmitOperatorTrie(ostream& aOut,
+	const vector<TableRow>&, const vector<TableRow>& compoundRows)
+{
+	WriteGeneratedHeader(aOut, "trie");
+	OperatorTrie trie;
+	if (!BuildOperatorTrie(compoundRows, trie)) {
+		aOut << "#error \"the compound operators do not fit OperatorTrieNode\"" << endl;
+		return;
+	}
+	vector<TableRow> trieRows;
+	for (size_t row : trie.rows)
+		trieRows.push_back(compoundRows[row]);
+	vector<uint16_t> labels(begin(trie.labels), end(trie.labels));
+
+	aOut << "// " << trie.nodes.size() << " nodes, " << trieRows.size() << " rows, "
+		<< trie.nodes.size() * (sizeof(OperatorTrieNode) + sizeof(char16_t)) + trieRows.size() * 3
+		<< " bytes" << endl << endl;
+	aOut << "static constexpr uint16_t gCompoundTrieNodeCount = " << trie.nodes.size() << ";" << endl;
+	aOut << "static constexpr uint16_t gCompoundTrieRowCount = " << trieRows.size() << ";" << endl << endl;
+	aOut << "static constexpr OperatorTrieNode gCompoundTrieNodes[gCompoundTrieNodeCount] = {";
+	for (size_t i = 0; i < trie.nodes.size(); ++i) {
+		const OperatorTrieNode& node = trie.nodes[i];
+		aOut << (i % 4 ? " " : "\n\t") << "{ " << node.mFirstChild << ", " << node.mFirstRow << ", "
+			<< int(node.mChildCount) << ", " << int(node.mRowCount) << " }"
+			<< (i + 1 < trie.nodes.size() ? "," : "");
+	}
+	aOut << endl << "};" << endl << endl;
+	WriteKeyColumn(aOut, "char16_t", "gCompoundTrieLabels", "gCompoundTrieNodeCount", labels);
+	WriteAttributeColumns(aOut, "gCompoundTrie", "gCompoundTrieRowCount", trieRows);
+}
+
+// One OperatorForms record per distinct key of aRows, in key order.
+// aKeyRows receives the first row of each key.
+static vector<OperatorForms>
+GroupForms(const vector<TableRow>& aRows, vector<size_t>& aKeyRows)
+{
+	static const nsOperatorFlags kFallback[] = {
+		NS_MATHML_OPERATOR_FORM_INFIX,
+		NS_MATHML_OPERATOR_FORM_POSTFIX,
+		NS_MATHML_OPERATOR_FORM_PREFIX
+	};
+	vector<OperatorForms> records;
+	aKeyRows.clear();
+	for (size_t i = 0; i < aRows.size(); ++i) {
+		const OperatorData& data = aRows[i].first;
+		if (aKeyRows.empty() || aRows[aKeyRows.back()].first.mStr != data.mStr) {
+			aKeyRows.push_back(i);
+			records.push_back(OperatorForms());
+		}
+		OperatorForms& record = records.back();
+		nsOperatorFlags form = NS_MATHML_OPERATOR_GET_FORM(data.mFlags);
+		record.mForms |= 1 << form;
+		record.mSpacing[form] = static_cast<uint8_t>(data.mLeadingSpace | data.mTrailingSpace << 4);
+		record.mFlags[form] = static_cast<uint16_t>(data.mFlags);
+	}
+	for (OperatorForms& record : records) {
+		for (nsOperatorFlags form : kFallback) {
+			nsOperatorFlags found = form;
+			for (size_t i = 0; !(record.mForms & (1 << found)); ++i)
+				found = kFallback[i];
+			record.mFallback |= found << (2 * form);
+		}
+	}
+	return records;
+}
+
+static void
+WriteFormsRecords(ostream& aOut, const char* aName, const char* aCount,
+	const vector<OperatorForms>& aRecords, const vector<TableRow>& aRows,
+	const vector<size_t>& aKeyRows)
+{
+	aOut << "static constexpr OperatorForms " << aName << "[" << aCount << "] = {" << endl;
+	for (size_t i = 0; i < aRecords.size(); ++i) {
+		const OperatorForms& record = aRecords[i];
+		aOut << "\t{ 0x" << hex << uppercase << int(record.mForms) << ", 0x" << int(record.mFallback) << ", {";
+		for (int form = 0; form < 4; ++form)
+			aOut << (form ? ", 0x" : " 0x") << setw(2) << setfill('0') << int(record.mSpacing[form]);
+		aOut << dec << " }, {";
+		for (int form = 0; form < 4; ++form)
+			aOut << (form ? ", " : " ") << (record.mFlags[form] ? FlagsExpression(record.mFlags[form]) : "0");
+		aOut << (i + 1 < aRecords.size() ? " } }, //" : " } } //") << aRows[aKeyRows[i]].second[1] << endl;
+	}
+	aOut << "};" << endl << endl;
+}
+
+// --layout=forms
+// One record per operator with the attributes of all its forms and the
+// form to use for each requested form, behind dense key columns
+static void
+EmitOperatorForms(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	vector<size_t> keyRows, compoundKeyRows;
+	vector<OperatorForms> records = GroupForms(rows, keyRows);
+	vector<OperatorForms> compoundRecords = GroupForms(compoundRows, compoundKeyRows);
+	vector<uint16_t> keys;
+	for (size_t row : keyRows)
+		keys.push_back(rows[row].first.mStr[0]);
+	vector<uint64_t> compoundKeys;
+	for (size_t row : compoundKeyRows) {
+		const u16string& str = compoundRows[row].first.mStr;
+		compoundKeys.push_back(OperatorCompoundKey(str.data(), static_cast<uint32_t>(str.size())));
+	}
+
+	WriteGeneratedHeader(aOut, "forms");
+	aOut << "static constexpr uint16_t gOperatorFormsCount = " << records.size() << ";" << endl;
+	aOut << "static constexpr uint16_t gCompoundOperFormsCount = " << compoundRecords.size() << ";" << endl << endl;
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorFormsKeys", "gOperatorFormsCount", keys);
+	WriteKeyColumn(aOut, "uint64_t", "gCompoundOperFormsKeys", "gCompoundOperFormsCount", compoundKeys);
+	WriteFormsRecords(aOut, "gOperatorForms", "gOperatorFormsCount", records, rows, keyRows);
+	WriteFormsRecords(aOut, "gCompoundOperForms", "gCompoundOperFormsCount",
+		compoundRecords, compoundRows, compoundKeyRows);
+}
+
+// The rows of aRows that have form aForm
+static vector<TableRow>
+FormRows(const vector<TableRow>& aRows, nsOperatorFlags aForm)
+{
+	vector<TableRow> formRows;
+	for (const auto& row : aRows) {
+		if (NS_MATHML_OPERATOR_GET_FORM(row.first.mFlags) == aForm)
+			formRows.push_back(row);
+	}
+	return formRows;
+}
+
+// --layout=byform
+// Sorted columns of the rows of each form on their own, so that a search
+// for a form known at compile time compares keys only, see
+// OperatorFormTable
+static void
+EmitOperatorFormTables(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	// in form order: 1 infix, 2 prefix, 3 postfix
+	static const char* const kFormNames[] = { "Infix", "Prefix", "Postfix" };
+
+	WriteGeneratedHeader(aOut, "byform");
+	aOut << "static_assert(kMaxPackedOperatorLength >= " << MaxKeyLength(compoundRows)
+		<< ", \"operator keys do not fit OperatorCompoundKey\");" << endl << endl;
+	for (nsOperatorFlags form = 1; form < 4; ++form) {
+		string name = kFormNames[form - 1];
+		vector<TableRow> formRows = FormRows(rows, form);
+		vector<TableRow> compoundFormRows = FormRows(compoundRows, form);
+		string prefix = "gOperator" + name, compoundPrefix = "gCompoundOper" + name;
+		string count = prefix + "Count", compoundCount = compoundPrefix + "Count";
+		aOut << "static constexpr uint16_t " << count << " = " << formRows.size() << ";" << endl;
+		aOut << "static constexpr uint16_t " << compoundCount << " = " << compoundFormRows.size() << ";" << endl << endl;
+		WriteKeyColumn(aOut, "uint16_t", (prefix + "Keys").c_str(), count.c_str(), SingleKeys(formRows));
+		WriteKeyColumn(aOut, "uint64_t", (compoundPrefix + "Keys").c_str(), compoundCount.c_str(),
+			CompoundKeys(compoundFormRows));
+		WriteAttributeColumns(aOut, prefix.c_str(), count.c_str(), formRows);
+		WriteAttributeColumns(aOut, compoundPrefix.c_str(), compoundCount.c_str(), compoundFormRows);
+	}
+	// indexed by form
+	const struct {
+		const char* mType;
+		const char* mName;
+		const char* mPrefix;
+	} tables[] = {
+		{ "uint16_t", "gOperatorFormTables", "gOperator" },
+		{ "uint64_t", "gCompoundOperFormTables", "gCompoundOper" }
+	};
+	for (const auto& table : tables) {
+		aOut << "static constexpr OperatorFormTable<" << table.mType << "> " << table.mName << "[4] = {" << endl
+			<< "\t{ nullptr, nullptr, nullptr, 0 }," << endl;
+		for (nsOperatorFlags form = 1; form < 4; ++form) {
+			string prefix = string(table.mPrefix) + kFormNames[form - 1];
+			aOut << "\t{ " << prefix << "Keys, " << prefix << "Flags, " << prefix << "Spacing, "
+				<< prefix << "Count" << (form < 3 ? " }," : " }") << endl;
+		}
+		aOut << "};" << endl << endl;
+	}
+}
+
+// Packed attributes of aRows, see OperatorPackAttributes.
+// Returns false if some row does not fit.
+static bool
+PackedAttributes(const vector<TableRow>& aRows, vector<uint32_t>& aAttributes)
+{
+	aAttributes.clear();
+	for (const auto& row : aRows) {
+		const OperatorData& data = row.first;
+		if (!OperatorCanPackAttributes(data.mFlags, data.mLeadingSpace, data.mTrailingSpace)) {
+			cerr << "attributes of" << row.second[1] << " do not fit 32 bits" << endl;
+			return false;
+		}
+		aAttributes.push_back(OperatorPackAttributes(data.mFlags, data.mLeadingSpace, data.mTrailingSpace));
+	}
+	return true;
+}
+
+// --layout=packed
+// Sorted key columns, each with a column of the packed 32 bit attributes
+// of its rows
+static void
+EmitOperatorPacked(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	WriteGeneratedHeader(aOut, "packed");
+	vector<uint32_t> attributes, compoundAttributes;
+	if (!PackedAttributes(rows, attributes) || !PackedAttributes(compoundRows, compoundAttributes)) {
+		aOut << "#error \"the Operator Dictionary does not fit packed attributes\"" << endl;
+		return;
+	}
+	aOut << "// " << rows.size() * (sizeof(uint16_t) + sizeof(uint32_t)) << " + "
+		<< compoundRows.size() * (sizeof(uint64_t) + sizeof(uint32_t)) << " bytes" << endl << endl;
+	aOut << "static_assert(kMaxPackedOperatorLength >= " << MaxKeyLength(compoundRows)
+		<< ", \"operator keys do not fit OperatorCompoundKey\");" << endl << endl;
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorPackedKeys", "gOperatorCount", SingleKeys(rows));
+	WriteKeyColumn(aOut, "uint64_t", "gCompoundOperPackedKeys", "gCompoundOperCount", CompoundKeys(compoundRows));
+	WriteKeyColumn(aOut, "uint32_t", "gOperatorPackedAttributes", "gOperatorCount", attributes);
+	WriteKeyColumn(aOut, "uint32_t", "gCompoundOperPackedAttributes", "gCompoundOperCount", compoundAttributes);
+}
+
+static bool
+SameForms(const OperatorForms& a, const OperatorForms& b)
+{
+	if (a.mForms != b.mForms || a.mFallback != b.mFallback)
+		return false;
+	for (int form = 0; form < 4; ++form) {
+		if (a.mSpacing[form] != b.mSpacing[form] || a.mFlags[form] != b.mFlags[form])
+			return false;
+	}
+	return true;
+}
+
+// The single character operators as maximal runs of consecutive code
+// points with the same attributes under every form. Each interval points
+// to one of the distinct OperatorForms records, its attribute class.
+struct OperatorIntervals {
+	vector<uint16_t>		firsts;
+	vector<uint16_t>		lasts;
+	vector<uint16_t>		classes;	// of each interval
+	vector<OperatorForms>	classRecords;
+	vector<size_t>			classRows;	// a row of each class, for its comment
+	size_t					operatorCount;
+};
+
+static OperatorIntervals
+BuildOperatorIntervals(const vector<TableRow>& rows)
+{
+	vector<size_t> keyRows;
+	vector<OperatorForms> records = GroupForms(rows, keyRows);
+	OperatorIntervals intervals;
+	vector<uint16_t>& firsts = intervals.firsts;
+	vector<uint16_t>& lasts = intervals.lasts;
+	vector<uint16_t>& classes = intervals.classes;
+	vector<OperatorForms>& classRecords = intervals.classRecords;
+	vector<size_t>& classRows = intervals.classRows;
+	for (size_t i = 0; i < records.size(); ++i) {
+		char16_t c = rows[keyRows[i]].first.mStr[0];
+		size_t found = 0;
+		while (found < classRecords.size() && !SameForms(classRecords[found], records[i]))
+			++found;
+		if (found == classRecords.size()) {
+			classRecords.push_back(records[i]);
+			classRows.push_back(keyRows[i]);
+		}
+		if (!lasts.empty() && lasts.back() + 1 == c && classes.back() == found) {
+			lasts.back() = c;
+			continue;
+		}
+		firsts.push_back(c);
+		lasts.push_back(c);
+		classes.push_back(static_cast<uint16_t>(found));
+	}
+	intervals.operatorCount = records.size();
+	return intervals;
+}
+
+// --layout=intervals
+// The intervals of BuildOperatorIntervals. Compound operators are left to
+// --layout=forms.
+static void
+EmitOperatorIntervals(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>&)
+{
+	OperatorIntervals intervals = BuildOperatorIntervals(rows);
+	const vector<uint16_t>& lasts = intervals.lasts;
+	const vector<uint16_t>& classes = intervals.classes;
+	const vector<OperatorForms>& classRecords = intervals.classRecords;
+
+	// a byte per class index if they fit
+	bool byteClasses = classRecords.size() <= 0x100;
+	WriteGeneratedHeader(aOut, "intervals");
+	aOut << "// " << intervals.operatorCount << " operators in " << lasts.size() << " intervals of "
+		<< classRecords.size() << " attribute classes, "
+		<< lasts.size() * (2 * sizeof(uint16_t) + (byteClasses ? 1 : 2)) + classRecords.size() * sizeof(OperatorForms)
+		<< " bytes" << endl << endl;
+	aOut << "static constexpr uint16_t gOperatorIntervalCount = " << lasts.size() << ";" << endl;
+	aOut << "static constexpr uint16_t gOperatorClassCount = " << classRecords.size() << ";" << endl << endl;
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorIntervalLasts", "gOperatorIntervalCount", lasts);
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorIntervalFirsts", "gOperatorIntervalCount", intervals.firsts);
+	if (byteClasses) {
+		WriteKeyColumn(aOut, "uint8_t", "gOperatorIntervalClasses", "gOperatorIntervalCount",
+			vector<uint8_t>(begin(classes), end(classes)));
+	}
+	else {
+		WriteKeyColumn(aOut, "uint16_t", "gOperatorIntervalClasses", "gOperatorIntervalCount", classes);
+	}
+	WriteFormsRecords(aOut, "gOperatorClasses", "gOperatorClassCount", classRecords, rows, intervals.classRows);
+}
+
+// Writes the nested switch matching the code units of the keys of
+// aRows[aFirst, aEnd) from aDepth on; they share the units before it.
+// Missing units read as 0, which ends a key.
+static void
+WriteSwitchCases(ostream& aOut, const vector<TableRow>& aRows,
+	const vector<uint32_t>& aAttributes, size_t aFirst, size_t aEnd, size_t aDepth)
+{
+	string indent(aDepth + 1, '\t');
+	aOut << indent << "switch (aLength > " << aDepth << " ? aStr[" << aDepth << "] : 0) {" << endl;
+	for (size_t i = aFirst; i < aEnd;) {
+		const u16string& str = aRows[i].first.mStr;
+		char16_t unit = aDepth < str.size() ? str[aDepth] : 0;
+		size_t next = i + 1;
+		while (next < aEnd && aDepth < aRows[next].first.mStr.size() && aRows[next].first.mStr[aDepth] == unit)
+			++next;
+		if (0 == unit) {
+			aOut << indent << "case 0: return 0x" << hex << uppercase << setw(8) << setfill('0')
+				<< aAttributes[i] << dec << "; //" << aRows[i].second[1] << endl;
+		}
+		else {
+			aOut << indent << "case " << CodeUnitLiteral(unit) << ":" << endl;
+			WriteSwitchCases(aOut, aRows, aAttributes, i, next, aDepth + 1);
+		}
+		i = next;
+	}
+	aOut << indent << "default: return 0;" << endl << indent << "}" << endl;
+}
+
+// --layout=switch
+// The dictionary as code: for each form, a function returning the packed
+// attributes of a single character operator from a switch over its code
+// point, and one for compound operators from nested switches over their
+// code units, so that the compiler picks jump tables and range checks.
+// They return 0 for operators that do not have the form.
+static void
+EmitOperatorSwitch(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	// in form order: 1 infix, 2 prefix, 3 postfix
+	static const char* const kFormNames[] = { "Infix", "Prefix", "Postfix" };
+
+	WriteGeneratedHeader(aOut, "switch");
+	for (nsOperatorFlags form = 1; form < 4; ++form) {
+		vector<TableRow> formRows = FormRows(rows, form);
+		vector<TableRow> compoundFormRows = FormRows(compoundRows, form);
+		vector<uint32_t> attributes, compoundAttributes;
+		if (!PackedAttributes(formRows, attributes) || !PackedAttributes(compoundFormRows, compoundAttributes)) {
+			aOut << "#error \"the Operator Dictionary does not fit packed attributes\"" << endl;
+			return;
+		}
+		aOut << "static inline uint32_t" << endl
+			<< "Operator" << kFormNames[form - 1] << "Switch(char16_t aChar)" << endl
+			<< "{" << endl << "\tswitch (aChar) {" << endl;
+		for (size_t i = 0; i < formRows.size(); ++i) {
+			aOut << "\tcase " << CodeUnitLiteral(formRows[i].first.mStr[0]) << ": return 0x" << hex << uppercase
+				<< setw(8) << setfill('0') << attributes[i] << dec << "; //" << formRows[i].second[1] << endl;
+		}
+		aOut << "\tdefault: return 0;" << endl << "\t}" << endl << "}" << endl << endl;
+
+		// the rows are sorted, so keys sharing a prefix are adjacent
+		aOut << "static inline uint32_t" << endl
+			<< "CompoundOper" << kFormNames[form - 1] << "Switch(const char16_t* aStr, uint32_t aLength)" << endl
+			<< "{" << endl;
+		WriteSwitchCases(aOut, compoundFormRows, compoundAttributes, 0, compoundFormRows.size(), 0);
+		aOut << "}" << endl << endl;
+	}
+}
+
+// --layout=bitmap
+// Presence bitmap of the single character operators and its rank
+// directory, see OperatorBitmapRank. Ranks index the records of
+// --layout=forms.
+static vector<uint64_t>
+BuildOperatorBitmap(const vector<TableRow>& rows, vector<uint16_t>& aRanks, size_t& aCount)
+{
+	vector<size_t> keyRows;
+	GroupForms(rows, keyRows);
+	vector<uint64_t> bitmap(kOperatorBitmapWords, 0);
+	for (size_t row : keyRows) {
+		char16_t c = rows[row].first.mStr[0];
+		bitmap[c >> 6] |= uint64_t(1) << (c & 63);
+	}
+	aRanks.clear();
+	uint32_t rank = 0;
+	for (uint64_t word : bitmap) {
+		aRanks.push_back(static_cast<uint16_t>(rank));
+		rank += OperatorPopCount(word);
+	}
+	aCount = keyRows.size();
+	return bitmap;
+}
+
+static void
+EmitOperatorBitmap(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>&)
+{
+	vector<uint16_t> ranks;
+	size_t count;
+	vector<uint64_t> bitmap = BuildOperatorBitmap(rows, ranks, count);
+
+	WriteGeneratedHeader(aOut, "bitmap");
+	aOut << "// " << count << " operators, "
+		<< bitmap.size() * sizeof(bitmap[0]) + ranks.size() * sizeof(ranks[0]) << " bytes" << endl << endl;
+	aOut << "static constexpr uint16_t gOperatorBitmapCount = " << count << ";" << endl << endl;
+	WriteKeyColumn(aOut, "uint64_t", "gOperatorBitmap", "kOperatorBitmapWords", bitmap);
+	WriteKeyColumn(aOut, "uint16_t", "gOperatorBitmapRanks", "kOperatorBitmapWords", ranks);
+}
+
+// target false positive rate of --layout=bloom, set with --bloom-fp=
+static double gBloomFalsePositiveRate = 0.01;
+
+static void
+SetBloomBits(vector<uint64_t>& aBits, uint32_t aBitCount, uint32_t aHashCount,
+	const u16string& aStr)
+{
+	uint64_t hash = OperatorStringHash(aStr.data(), static_cast<uint32_t>(aStr.size()));
+	for (uint32_t i = 0; i < aHashCount; ++i) {
+		uint32_t bit = OperatorBloomBit(hash, i, aBitCount);
+		aBits[bit >> 6] |= uint64_t(1) << (bit & 63);
+	}
+}
+
+// --layout=bloom
+// Bloom filter over the compound operators, see OperatorBloomMayContain
+static void
+EmitOperatorBloom(ostream& aOut,
+	const vector<TableRow>&, const vector<TableRow>& compoundRows)
+{
+	vector<u16string> keys;
+	for (const auto& row : compoundRows) {
+		if (keys.empty() || keys.back() != row.first.mStr)
+			keys.push_back(row.first.mStr);
+	}
+	// optimal size and number of hashes for the rate requested
+	double rate = min(max(gBloomFalsePositiveRate, 1e-9), 0.5);
+	double ln2 = log(2.0);
+	uint32_t bitCount = static_cast<uint32_t>(ceil(-double(keys.size()) * log(rate) / (ln2 * ln2)));
+	bitCount = max(64u, (bitCount + 63) / 64 * 64);
+	// with no keys, an empty filter that rejects every string
+	uint32_t hashCount = keys.empty() ? 1 :
+		max(1u, static_cast<uint32_t>(lround(double(bitCount) / keys.size() * ln2)));
+	vector<uint64_t> bits(bitCount / 64, 0);
+	for (const u16string& key : keys)
+		SetBloomBits(bits, bitCount, hashCount, key);
+
+	// measure the rate on the two and three character ASCII strings
+	// that are not operators, which is what text in <mo> looks like
+	size_t tested = 0, falsePositives = 0;
+	u16string probe;
+	for (char16_t a = 0x21; a < 0x7F; ++a) {
+		for (char16_t b = 0x21; b < 0x7F; ++b) {
+			for (char16_t c = 0x20; c < 0x7F; ++c) {
+				probe.assign({ a, b, c });
+				if (c == 0x20)
+					probe.resize(2);
+				if (binary_search(keys.begin(), keys.end(), probe))
+					continue;
+				++tested;
+				falsePositives += OperatorBloomMayContain(bits.data(), bitCount, hashCount,
+					probe.data(), static_cast<uint32_t>(probe.size()));
+			}
+		}
+	}
+	double measured = double(falsePositives) / tested;
+
+	WriteGeneratedHeader(aOut, "bloom");
+	aOut << "// " << keys.size() << " keys, " << bitCount << " bits, " << hashCount
+		<< " hashes, target false positive rate " << rate << ", measured " << measured << endl << endl;
+	aOut << "static constexpr uint32_t gCompoundOperBloomBitCount = " << bitCount << ";" << endl;
+	aOut << "static constexpr uint32_t gCompoundOperBloomHashCount = " << hashCount << ";" << endl << endl;
+	WriteKeyColumn(aOut, "uint64_t", "gCompoundOperBloom", "gCompoundOperBloomBitCount / 64", bits);
+	cout << "bloom: " << keys.size() << " keys, " << bitCount << " bits, " << hashCount
+		<< " hashes, false positive rate " << rate << " (measured " << measured << ")" << endl;
+}
+
+// Appends aColumn to aFile, aligned on the size of its elements, and
+// returns its offset
+template<typename T>
+static uint32_t
+AppendColumn(vector<uint8_t>& aFile, const vector<T>& aColumn)
+{
+	while (aFile.size() % sizeof(T))
+		aFile.push_back(0);
+	uint32_t offset = static_cast<uint32_t>(aFile.size());
+	for (T value : aColumn) {
+		for (size_t byte = 0; byte < sizeof(T); ++byte)
+			aFile.push_back(static_cast<uint8_t>(uint64_t(value) >> (8 * byte)));
+	}
+	return offset;
+}
+
+static void
+StoreLittleEndian(vector<uint8_t>& aFile, size_t aOffset, uint32_t aValue, size_t aSize)
+{
+	for (size_t byte = 0; byte < aSize; ++byte)
+		aFile[aOffset + byte] = static_cast<uint8_t>(aValue >> (8 * byte));
+}
+
+// --layout=binary
+// Binary Operator Dictionary, see OperatorDictionaryHeader
+static void
+EmitOperatorDictionary(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+{
+	if (MaxKeyLength(compoundRows) > kMaxPackedOperatorLength) {
+		cerr << "binary: operator keys do not fit OperatorCompoundKey" << endl;
+		return;
+	}
+	vector<uint16_t> flags, compoundFlags;
+	vector<uint8_t> spacing, compoundSpacing;
+	for (const auto& row : rows) {
+		flags.push_back(static_cast<uint16_t>(row.first.mFlags));
+		spacing.push_back(static_cast<uint8_t>(row.first.mLeadingSpace | row.first.mTrailingSpace << 4));
+	}
+	for (const auto& row : compoundRows) {
+		compoundFlags.push_back(static_cast<uint16_t>(row.first.mFlags));
+		compoundSpacing.push_back(static_cast<uint8_t>(row.first.mLeadingSpace | row.first.mTrailingSpace << 4));
+	}
+
+	OperatorDictionaryHeader header = {};
+	vector<uint8_t> file(sizeof(header), 0);
+	header.mMagic = kOperatorDictionaryMagic;
+	header.mVersion = kOperatorDictionaryVersion;
+	header.mHeaderSize = sizeof(header);
+	header.mCount = static_cast<uint32_t>(rows.size());
+	header.mCompoundCount = static_cast<uint32_t>(compoundRows.size());
+	// widest elements first, to keep the padding down
+	header.mCompoundKeys = AppendColumn(file, CompoundKeys(compoundRows));
+	header.mKeys = AppendColumn(file, SingleKeys(rows));
+	header.mFlags = AppendColumn(file, flags);
+	header.mCompoundFlags = AppendColumn(file, compoundFlags);
+	header.mSpacing = AppendColumn(file, spacing);
+	header.mCompoundSpacing = AppendColumn(file, compoundSpacing);
+	header.mFileSize = static_cast<uint32_t>(file.size());
+	header.mChecksum = OperatorDictionaryChecksum(file.data() + sizeof(header),
+		static_cast<uint32_t>(file.size() - sizeof(header)));
+
+#define STORE_HEADER_FIELD(_field) \
+	StoreLittleEndian(file, offsetof(OperatorDictionaryHeader, _field), \
+		header._field, sizeof(header._field))
+	STORE_HEADER_FIELD(mMagic);
+	STORE_HEADER_FIELD(mVersion);
+	STORE_HEADER_FIELD(mHeaderSize);
+	STORE_HEADER_FIELD(mFileSize);
+	STORE_HEADER_FIELD(mChecksum);
+	STORE_HEADER_FIELD(mCount);
+	STORE_HEADER_FIELD(mCompoundCount);
+	STORE_HEADER_FIELD(mKeys);
+	STORE_HEADER_FIELD(mFlags);
+	STORE_HEADER_FIELD(mSpacing);
+	STORE_HEADER_FIELD(mCompoundKeys);
+	STORE_HEADER_FIELD(mCompoundFlags);
+	STORE_HEADER_FIELD(mCompoundSpacing);
+#undef STORE_HEADER_FIELD
+	aOut.write(reinterpret_cast<const char*>(file.data()), file.size());
+}
+
+// text of mathfont.properties, for --layout=properties
+static string_view gPropertiesText;
+
+// --layout=properties
+// The bytes of mathfont.properties, for the compile-time parser of
+// nsMathMLOperatorParser.h on compilers without #embed. Written with the
+// tables, it can only check that the two parsers agree; a build that
+// wants stale tables caught writes MATHML_OPERATOR_PROPERTIES_BYTES from
+// mathfont.properties itself.
+static void
+EmitOperatorProperties(ostream& aOut,
+	const vector<TableRow>&, const vector<TableRow>&)
+{
+	WriteGeneratedHeader(aOut, "properties");
+	for (size_t i = 0; i < gPropertiesText.size(); ++i) {
+		aOut << (i % 24 ? " " : (i ? "\n\t" : "\t")) << int(static_cast<unsigned char>(gPropertiesText[i]))
+			<< (i + 1 < gPropertiesText.size() ? "," : "");
+	}
+	aOut << endl;
+}
+
+typedef void (*LayoutEmitter)(ostream& aOut,
+	const vector<TableRow>& rows, const vector<TableRow>& compoundRows);
+
+// Additional outputs, selected with --layout=<name>.
+// Paths are relative to the repository root.
+static const struct {
+	string_view		name;
+	const char*		path;
+	LayoutEmitter	emit;
+} kLayouts[] = {
+	{ "constexpr", "mathML/nsMathMLOperatorTables.inc", EmitConstexprTables },
+	{ "hash", "mathML/nsMathMLOperatorHash.inc", EmitOperatorHash },
+	{ "pagetable", "mathML/nsMathMLOperatorPageTable.inc", EmitOperatorPageTable },
+	{ "columns", "mathML/nsMathMLOperatorColumns.inc", EmitOperatorColumns },
+	{ "eytzinger", "mathML/nsMathMLOperatorEytzinger.inc", EmitOperatorEytzinger },
+	{ "simd", "mathML/nsMathMLOperatorBlocks.inc", EmitOperatorBlocks },
+	{ "learned", "mathML/nsMathMLOperatorLearned.inc", EmitOperatorLearned },
+	{ "trie", "mathML/nsMathMLOperatorTrie.inc", EmitOperatorTrie },
+	{ "forms", "mathML/nsMathMLOperatorForms.inc", EmitOperatorForms },
+	{ "byform", "mathML/nsMathMLOperatorFormTables.inc", EmitOperatorFormTables },
+	{ "packed", "mathML/nsMathMLOperatorPacked.inc", EmitOperatorPacked },
+	{ "bitmap", "mathML/nsMathMLOperatorBitmap.inc", EmitOperatorBitmap },
+	{ "intervals", "mathML/nsMathMLOperatorIntervals.inc", EmitOperatorIntervals },
+	{ "switch", "mathML/nsMathMLOperatorSwitch.inc", EmitOperatorSwitch },
+	{ "bloom", "mathML/nsMathMLOperatorBloom.inc", EmitOperatorBloom },
+	{ "binary", "mathML/nsMathMLOperatorDictionary.bin", EmitOperatorDictionary },
+	{ "properties", "mathML/nsMathMLOperatorProperties.inc", EmitOperatorProperties }
+};
+
+////////////////////////////////////////////////////////////////////////////
+// --tune
+//
+// Builds the tables of each MATHML_OPERATOR_LAYOUT in memory, times the
+// searches nsMathMLOperators.cpp runs on them, which it shares through
+// nsMathMLOperatorLookup.h, on a mix of lookups, and picks the fastest on
+// this machine.
+
+// longest key of the OperatorData rows of nsMathMLOperators.cpp
+static const uint32_t kTuneMaxLength = 3;
+typedef OperatorRow<kTuneMaxLength> TuneRow;
+
+static bool
+SameAttributes(const OperatorAttributes& a, const OperatorAttributes& b)
+{
+	return a.mFlags == b.mFlags && a.mLeadingSpace == b.mLeadingSpace &&
+		a.mTrailingSpace == b.mTrailingSpace;
+}
+
+// The OperatorData rows of --layout=constexpr for aRows, in their order
+static vector<TuneRow>
+TuneRows(const vector<TableRow>& aRows)
+{
+	vector<TuneRow> tuneRows;
+	for (const auto& row : aRows) {
+		TuneRow data = {};
+		const u16string& str = row.first.mStr;
+		copy(begin(str), begin(str) + min<size_t>(str.size(), kTuneMaxLength), data.mStr);
+		data.mLength = static_cast<uint8_t>(str.size());
+		data.mLeadingSpace = row.first.mLeadingSpace;
+		data.mTrailingSpace = row.first.mTrailingSpace;
+		data.mFlags = row.first.mFlags;
+		tuneRows.push_back(data);
+	}
+	return tuneRows;
+}
+
+// The attributes of aRow, if a search found one
+static bool
+RowAttributes(const TuneRow* aRow, OperatorAttributes* aResult)
+{
+	if (!aRow)
+		return false;
+	*aResult = { aRow->mFlags, aRow->mLeadingSpace, aRow->mTrailingSpace };
+	return true;
+}
+
+static bool
+FormsAttributes(const OperatorForms* aForms, nsOperatorFlags aForm, OperatorAttributes* aResult)
+{
+	if (!aForms)
+		return false;
+	SelectOperatorForms(*aForms, aForm, aResult);
+	return true;
+}
+
+// Keys OperatorLowerBound reads among aCount keys
+static uint32_t
+LowerBoundProbes(uint32_t aCount)
+{
+	uint32_t probes = aCount ? 1 : 0;
+	for (; aCount > 1; aCount -= aCount / 2)
+		++probes;
+	return probes;
+}
+
+// Keys OperatorEytzingerLowerBound reads among aCount keys
+static uint32_t
+EytzingerProbes(uint32_t aCount)
+{
+	uint32_t probes = 0;
+	for (uint32_t k = 1; k <= aCount; k = 2 * k)
+		++probes;
+	return probes;
+}
+
+// Sorted key, flags and spacing columns, as in --layout=columns
+template<typename Key>
+struct TuneColumns {
+	vector<Key>			mKeys;
+	vector<uint16_t>	mFlags;
+	vector<uint8_t>		mSpacing;
+
+	TuneColumns(const vector<TableRow>& aRows, const vector<Key>& aKeys)
+		: mKeys(aKeys)
+	{
+		for (const auto& row : aRows) {
+			mFlags.push_back(static_cast<uint16_t>(row.first.mFlags));
+			mSpacing.push_back(static_cast<uint8_t>(row.first.mLeadingSpace | row.first.mTrailingSpace << 4));
+		}
+	}
+
+	size_t Bytes() const { return mKeys.size() * (sizeof(Key) + sizeof(uint16_t) + sizeof(uint8_t)); }
+	uint32_t Size() const { return static_cast<uint32_t>(mKeys.size()); }
+
+	bool Find(Key aKey, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		return OperatorColumnSearch(mKeys.data(), mFlags.data(), mSpacing.data(), Size(),
+			aKey, aForm, aResult);
+	}
+};
+
+// Sorted key column of OperatorForms records, as in --layout=forms
+template<typename Key>
+struct TuneForms {
+	vector<Key>				mKeys;
+	vector<OperatorForms>	mRecords;
+
+	TuneForms(const vector<TableRow>& aRows, bool aCompound)
+	{
+		vector<size_t> keyRows;
+		mRecords = GroupForms(aRows, keyRows);
+		for (size_t row : keyRows) {
+			const u16string& str = aRows[row].first.mStr;
+			mKeys.push_back(static_cast<Key>(aCompound ?
+				OperatorCompoundKey(str.data(), static_cast<uint32_t>(str.size())) : str[0]));
+		}
+	}
+
+	size_t Bytes() const { return mKeys.size() * (sizeof(Key) + sizeof(OperatorForms)); }
+	uint32_t Size() const { return static_cast<uint32_t>(mKeys.size()); }
+
+	bool Find(Key aKey, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		return FormsAttributes(OperatorFormsSearch(mKeys.data(), mRecords.data(), Size(), aKey),
+			aForm, aResult);
+	}
+};
+
+// Each layout below holds the tables nsMathMLOperators.cpp reads under its
+// MATHML_OPERATOR_LAYOUT, and Find runs the search of GetOperatorAttributes
+// on them. Probes estimates the keys and records that search reads.
+
+// MATHML_OPERATOR_LAYOUT_SORTED
+struct TuneSortedLayout {
+	vector<TuneRow> mSingle, mCompound;
+
+	TuneSortedLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: mSingle(TuneRows(rows)), mCompound(TuneRows(compoundRows)) {}
+
+	size_t Bytes() const { return (mSingle.size() + mCompound.size()) * sizeof(TuneRow); }
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		const vector<TuneRow>& table = aLength == 1 ? mSingle : mCompound;
+		return RowAttributes(OperatorRowSearch(table.data(), static_cast<uint16_t>(table.size()),
+			aStr, aLength, aForm), aResult);
+	}
+
+	uint32_t Probes(uint32_t aLength) const
+	{
+		return LowerBoundProbes(static_cast<uint32_t>((aLength == 1 ? mSingle : mCompound).size()));
+	}
+};
+
+// MATHML_OPERATOR_LAYOUT_HASH
+struct TuneHashLayout : TuneSortedLayout {
+	OperatorHashLayout	mHash;
+	bool				mBuilt;	// else every lookup fails, and the check rejects it
+	vector<TuneRow>		mSlots;
+
+	TuneHashLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: TuneSortedLayout(rows, compoundRows), mBuilt(BuildOperatorHash(rows, mHash))
+	{
+		for (size_t row : mHash.slots)
+			mSlots.push_back(mSingle[row]);
+	}
+
+	// the sorted single character rows are not read
+	size_t Bytes() const
+	{
+		return mHash.seeds.size() * sizeof(uint16_t) + (mSlots.size() + mCompound.size()) * sizeof(TuneRow);
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength > 1)
+			return TuneSortedLayout::Find(aStr, aLength, aForm, aResult);
+		if (!mBuilt)
+			return false;
+		return RowAttributes(OperatorHashSearch(mSlots.data(), mHash.salt, mHash.seeds.data(),
+			static_cast<uint32_t>(mHash.seeds.size()), static_cast<uint32_t>(mSlots.size()),
+			aStr[0], aForm), aResult);
+	}
+
+	// a seed and a slot
+	uint32_t Probes(uint32_t aLength) const { return aLength > 1 ? TuneSortedLayout::Probes(aLength) : 2; }
+};
+
+// MATHML_OPERATOR_LAYOUT_PAGE_TABLE
+struct TunePageTableLayout : TuneSortedLayout {
+	OperatorPageTable	mTable;
+
+	TunePageTableLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: TuneSortedLayout(rows, compoundRows), mTable(BuildOperatorPageTable(rows)) {}
+
+	size_t Bytes() const
+	{
+		return TuneSortedLayout::Bytes() + mTable.index.size() + mTable.pages.size() * sizeof(mTable.pages[0]);
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		static_assert(sizeof(mTable.pages[0]) == kOperatorPageSize * sizeof(uint16_t),
+			"the pages are read as uint16_t[kOperatorPageSize]");
+		if (aLength > 1)
+			return TuneSortedLayout::Find(aStr, aLength, aForm, aResult);
+		return RowAttributes(OperatorPageSearch(mTable.index.data(),
+			reinterpret_cast<const uint16_t (*)[kOperatorPageSize]>(mTable.pages.data()),
+			mSingle.data(), static_cast<uint32_t>(mSingle.size()), aStr[0], aForm), aResult);
+	}
+
+	// the index, the page and a row
+	uint32_t Probes(uint32_t aLength) const { return aLength > 1 ? TuneSortedLayout::Probes(aLength) : 3; }
+};
+
+// MATHML_OPERATOR_LAYOUT_COLUMNS
+struct TuneColumnsLayout {
+	TuneColumns<uint16_t>	mSingle;
+	TuneColumns<uint64_t>	mCompound;
+
+	TuneColumnsLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: mSingle(rows, SingleKeys(rows)), mCompound(compoundRows, CompoundKeys(compoundRows)) {}
+
+	size_t Bytes() const { return mSingle.Bytes() + mCompound.Bytes(); }
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength == 1)
+			return mSingle.Find(uint16_t(aStr[0]), aForm, aResult);
+		return mCompound.Find(OperatorCompoundKey(aStr, aLength), aForm, aResult);
+	}
+
+	uint32_t Probes(uint32_t aLength) const
+	{
+		return LowerBoundProbes(aLength == 1 ? mSingle.Size() : mCompound.Size());
+	}
+};
+
+// MATHML_OPERATOR_LAYOUT_EYTZINGER
+struct TuneEytzingerLayout : TuneColumnsLayout {
+	vector<uint16_t>	mNodeKeys, mNodeRows, mCompoundNodeRows;
+	vector<uint64_t>	mCompoundNodeKeys;
+
+	TuneEytzingerLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: TuneColumnsLayout(rows, compoundRows)
+	{
+		mNodeKeys = EytzingerOrder(mSingle.mKeys, mNodeRows);
+		mCompoundNodeKeys = EytzingerOrder(mCompound.mKeys, mCompoundNodeRows);
+	}
+
+	size_t Bytes() const
+	{
+		return TuneColumnsLayout::Bytes() + mNodeKeys.size() * 2 * sizeof(uint16_t) +
+			mCompoundNodeKeys.size() * (sizeof(uint64_t) + sizeof(uint16_t));
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength == 1) {
+			return OperatorEytzingerSearch(mNodeKeys.data(), mNodeRows.data(),
+				mSingle.mKeys.data(), mSingle.mFlags.data(), mSingle.mSpacing.data(),
+				mSingle.Size(), uint16_t(aStr[0]), aForm, aResult);
+		}
+		return OperatorEytzingerSearch(mCompoundNodeKeys.data(), mCompoundNodeRows.data(),
+			mCompound.mKeys.data(), mCompound.mFlags.data(), mCompound.mSpacing.data(),
+			mCompound.Size(), OperatorCompoundKey(aStr, aLength), aForm, aResult);
+	}
+
+	uint32_t Probes(uint32_t aLength) const
+	{
+		return EytzingerProbes(aLength == 1 ? mSingle.Size() : mCompound.Size()) + 1;
+	}
+};
+
+// MATHML_OPERATOR_LAYOUT_SIMD
+struct TuneSimdLayout : TuneColumnsLayout {
+	vector<uint16_t>	mLastKeys, mBlockedKeys;
+
+	TuneSimdLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: TuneColumnsLayout(rows, compoundRows), mBlockedKeys(BlockedKeys(rows, mLastKeys)) {}
+
+	size_t Bytes() const
+	{
+		return TuneColumnsLayout::Bytes() + (mLastKeys.size() + mBlockedKeys.size()) * sizeof(uint16_t);
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength > 1)
+			return TuneColumnsLayout::Find(aStr, aLength, aForm, aResult);
+		return OperatorBlockColumnSearch(mLastKeys.data(), mBlockedKeys.data(),
+			mSingle.mKeys.data(), mSingle.mFlags.data(), mSingle.mSpacing.data(),
+			mSingle.Size(), aStr[0], aForm, aResult);
+	}
+
+	// the summary, then one block
+	uint32_t Probes(uint32_t aLength) const
+	{
+		if (aLength > 1)
+			return TuneColumnsLayout::Probes(aLength);
+		return LowerBoundProbes(static_cast<uint32_t>(mLastKeys.size())) + 1;
+	}
+};
+
+// MATHML_OPERATOR_LAYOUT_LEARNED
+struct TuneLearnedLayout : TuneColumnsLayout {
+	OperatorLearnedModel mModel;
+
+	TuneLearnedLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: TuneColumnsLayout(rows, compoundRows), mModel(FitOperatorLearned(rows)) {}
+
+	size_t Bytes() const
+	{
+		return TuneColumnsLayout::Bytes() + mModel.keys.size() * (2 * sizeof(uint16_t) + sizeof(uint32_t));
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength > 1)
+			return TuneColumnsLayout::Find(aStr, aLength, aForm, aResult);
+		return OperatorLearnedColumnSearch(mModel.keys.data(), mModel.rows.data(), mModel.slopes.data(),
+			static_cast<uint32_t>(mModel.keys.size()), mModel.maxError,
+			mSingle.mKeys.data(), mSingle.mFlags.data(), mSingle.mSpacing.data(),
+			mSingle.Size(), aStr[0], aForm, aResult);
+	}
+
+	// the segments, the segment found, then the window of its error
+	uint32_t Probes(uint32_t aLength) const
+	{
+		if (aLength > 1)
+			return TuneColumnsLayout::Probes(aLength);
+		return LowerBoundProbes(static_cast<uint32_t>(mModel.keys.size())) + 1 +
+			LowerBoundProbes(2 * mModel.maxError + 1);
+	}
+};
+
+// MATHML_OPERATOR_LAYOUT_PACKED
+struct TunePackedLayout {
+	vector<uint16_t>	mKeys;
+	vector<uint64_t>	mCompoundKeys;
+	vector<uint32_t>	mAttributes, mCompoundAttributes;
+
+	TunePackedLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: mKeys(SingleKeys(rows)), mCompoundKeys(CompoundKeys(compoundRows))
+	{
+		PackedAttributes(rows, mAttributes);
+		PackedAttributes(compoundRows, mCompoundAttributes);
+	}
+
+	size_t Bytes() const
+	{
+		return mKeys.size() * (sizeof(uint16_t) + sizeof(uint32_t)) +
+			mCompoundKeys.size() * (sizeof(uint64_t) + sizeof(uint32_t));
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength == 1) {
+			return OperatorPackedSearch(mKeys.data(), mAttributes.data(),
+				static_cast<uint32_t>(mKeys.size()), uint16_t(aStr[0]), aForm, aResult);
+		}
+		return OperatorPackedSearch(mCompoundKeys.data(), mCompoundAttributes.data(),
+			static_cast<uint32_t>(mCompoundKeys.size()), OperatorCompoundKey(aStr, aLength),
+			aForm, aResult);
+	}
+
+	uint32_t Probes(uint32_t aLength) const
+	{
+		return LowerBoundProbes(static_cast<uint32_t>(aLength == 1 ? mKeys.size() : mCompoundKeys.size())) + 1;
+	}
+};
+
+// MATHML_OPERATOR_LAYOUT_FORMS
+struct TuneFormsLayout {
+	TuneForms<uint16_t>	mSingle;
+	TuneForms<uint64_t>	mCompound;
+
+	TuneFormsLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: mSingle(rows, false), mCompound(compoundRows, true) {}
+
+	size_t Bytes() const { return mSingle.Bytes() + mCompound.Bytes(); }
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength == 1)
+			return mSingle.Find(uint16_t(aStr[0]), aForm, aResult);
+		return mCompound.Find(OperatorCompoundKey(aStr, aLength), aForm, aResult);
+	}
+
+	uint32_t Probes(uint32_t aLength) const
+	{
+		return LowerBoundProbes(aLength == 1 ? mSingle.Size() : mCompound.Size()) + 1;
+	}
+};
+
+// MATHML_OPERATOR_LAYOUT_BITMAP
+struct TuneBitmapLayout : TuneFormsLayout {
+	vector<uint64_t>	mBitmap;
+	vector<uint16_t>	mRanks;
+
+	TuneBitmapLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: TuneFormsLayout(rows, compoundRows)
+	{
+		size_t count;
+		mBitmap = BuildOperatorBitmap(rows, mRanks, count);
+	}
+
+	// the single character key column is not read
+	size_t Bytes() const
+	{
+		return mSingle.mRecords.size() * sizeof(OperatorForms) + mCompound.Bytes() +
+			mBitmap.size() * sizeof(uint64_t) + mRanks.size() * sizeof(uint16_t);
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength > 1)
+			return TuneFormsLayout::Find(aStr, aLength, aForm, aResult);
+		return FormsAttributes(OperatorBitmapFormsSearch(mBitmap.data(), mRanks.data(),
+			mSingle.mRecords.data(), aStr[0]), aForm, aResult);
+	}
+
+	// the word, its rank and the record
+	uint32_t Probes(uint32_t aLength) const { return aLength > 1 ? TuneFormsLayout::Probes(aLength) : 3; }
+};
+
+// MATHML_OPERATOR_LAYOUT_INTERVALS
+struct TuneIntervalsLayout : TuneFormsLayout {
+	OperatorIntervals	mIntervals;
+	vector<uint8_t>		mClasses;
+
+	TuneIntervalsLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows)
+		: TuneFormsLayout(rows, compoundRows), mIntervals(BuildOperatorIntervals(rows)),
+		  mClasses(begin(mIntervals.classes), end(mIntervals.classes)) {}
+
+	// the single character records of --layout=forms are not read
+	size_t Bytes() const
+	{
+		return mIntervals.lasts.size() * (2 * sizeof(uint16_t) + sizeof(uint8_t)) +
+			mIntervals.classRecords.size() * sizeof(OperatorForms) + mCompound.Bytes();
+	}
+
+	bool Find(const char16_t* aStr, uint32_t aLength, nsOperatorFlags aForm, OperatorAttributes* aResult) const
+	{
+		if (aLength > 1)
+			return TuneFormsLayout::Find(aStr, aLength, aForm, aResult);
+		return FormsAttributes(OperatorIntervalFormsSearch(mIntervals.firsts.data(), mIntervals.lasts.data(),
+			mClasses.data(), mIntervals.classRecords.data(), static_cast<uint32_t>(mClasses.size()),
+			aStr[0]), aForm, aResult);
+	}
+
+	// the lasts, then the first, the class and the record
+	uint32_t Probes(uint32_t aLength) const
+	{
+		if (aLength > 1)
+			return TuneFormsLayout::Probes(aLength);
+		return LowerBoundProbes(static_cast<uint32_t>(mClasses.size())) + 3;
+	}
+};
+
+// one lookup of the mix
+struct TuneLookup {
+	u16string		mStr;
+	nsOperatorFlags	mForm;
+};
+
+struct TuneResult {
+	size_t	mBytes;
+	double	mAverage;	// ns per lookup
+	double	mP99;		// ns per lookup, 99th percentile of the means of the batches
+	double	mProbes;	// keys and records read per lookup, estimated from the table sizes
+	bool	mValid;		// found what the dictionary says on the whole mix
+};
+
+// lookups timed together, as a single lookup is too short for the clock
+static const size_t kTuneBatch = 32;
+// passes over the mix per trial, the first one warming the caches up
+static const int kTuneRounds = 20;
+// trials per layout; the one with the lowest average is kept, as
+// interrupts and frequency changes only ever make a trial slower
+static const int kTuneTrials = 5;
+
+static volatile uint32_t gTuneSink;
+
+template<typename Layout>
+static inline bool
+TuneFind(const Layout& aLayout, const TuneLookup& aLookup, OperatorAttributes& aResult)
+{
+	// as GetOperatorAttributes
+	uint32_t length = static_cast<uint32_t>(aLookup.mStr.size());
+	if (0 == length || length > kTuneMaxLength || !OperatorCanPackKey(aLookup.mStr.data(), length))
+		return false;
+	return aLayout.Find(aLookup.mStr.data(), length, aLookup.mForm, &aResult);
+}
+
+// Builds Layout, checks it against aExpected, the result of each lookup
+// of aMix, and times it
+template<typename Layout>
+static TuneResult
+MeasureLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows,
+	const vector<TuneLookup>& aMix, const vector<pair<bool, OperatorAttributes>>& aExpected)
+{
+	Layout layout(rows, compoundRows);
+	TuneResult result = { layout.Bytes(), 0, 0, 0, true };
+
+	uint64_t probes = 0;
+	for (size_t i = 0; i < aMix.size(); ++i) {
+		OperatorAttributes found = {};
+		bool ok = TuneFind(layout, aMix[i], found);
+		probes += layout.Probes(static_cast<uint32_t>(aMix[i].mStr.size()));
+		if (ok != aExpected[i].first || (ok && !SameAttributes(found, aExpected[i].second)))
+			result.mValid = false;
+	}
+	result.mProbes = double(probes) / aMix.size();
+
+	uint32_t sink = 0;
+	result.mAverage = HUGE_VAL;
+	for (int trial = 0; trial < kTuneTrials; ++trial) {
+		vector<double> batches;
+		double total = 0;
+		for (int round = 0; round < kTuneRounds; ++round) {
+			for (size_t first = 0; first < aMix.size(); first += kTuneBatch) {
+				size_t end = min(first + kTuneBatch, aMix.size());
+				auto start = chrono::steady_clock::now();
+				for (size_t i = first; i < end; ++i) {
+					OperatorAttributes found = {};
+					if (TuneFind(layout, aMix[i], found))
+						sink += found.mFlags;
+				}
+				double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+				if (0 == round)
+					continue;
+				total += ns;
+				batches.push_back(ns / (end - first));
+			}
+		}
+		double average = total / (double(kTuneRounds - 1) * aMix.size());
+		if (average < result.mAverage) {
+			sort(begin(batches), end(batches));
+			result.mAverage = average;
+			result.mP99 = batches[(batches.size() - 1) * 99 / 100];
+		}
+	}
+	gTuneSink = sink;
+	return result;
+}
+
+// What the dictionary says for aLookup, read off the parsed rows rather
+// than any layout: the row of the form asked for, else of the first of
+// infix, postfix, prefix that is listed
+static bool
+DictionaryAttributes(const vector<TableRow>& aRows, const TuneLookup& aLookup, OperatorAttributes& aResult)
+{
+	const OperatorData* forms[4] = {};
+	for (const auto& row : aRows) {
+		if (row.first.mStr == aLookup.mStr)
+			forms[NS_MATHML_OPERATOR_GET_FORM(row.first.mFlags)] = &row.first;
+	}
+	const nsOperatorFlags order[] = { aLookup.mForm, NS_MATHML_OPERATOR_FORM_INFIX,
+		NS_MATHML_OPERATOR_FORM_POSTFIX, NS_MATHML_OPERATOR_FORM_PREFIX };
+	for (nsOperatorFlags form : order) {
+		if (forms[form]) {
+			aResult = { forms[form]->mFlags, forms[form]->mLeadingSpace, forms[form]->mTrailingSpace };
+			return true;
+		}
+	}
+	return false;
+}
+
+// strings of the mix that are not in the dictionary: words of <mo> such as
+// function names, and letters
+static const char16_t* const kTuneNotOperators[] = {
+	u"sin", u"cos", u"log", u"tan", u"exp", u"a", u"x", u"\u03B1", u"\u2003", u"\u0430"
+};
+
+// A mix like the <mo> of documents: half ASCII operators, mostly the
+// rest of the dictionary, and a tenth of strings that are not operators,
+// mostly infix as in an mrow.
+// Returns false if one of kTuneNotOperators is in the dictionary after all.
+static bool
+TuneLookupMix(const vector<TableRow>& rows, const vector<TableRow>& compoundRows, vector<TuneLookup>& aMix)
+{
+	static const size_t kMixSize = 4096;
+
+	for (const char16_t* str : kTuneNotOperators) {
+		TuneLookup lookup = { str, NS_MATHML_OPERATOR_FORM_INFIX };
+		OperatorAttributes attributes;
+		if (DictionaryAttributes(lookup.mStr.size() == 1 ? rows : compoundRows, lookup, attributes)) {
+			cerr << "kTuneNotOperators lists the operator";
+			for (char16_t c : lookup.mStr)
+				cerr << " U+" << hex << uppercase << setw(4) << setfill('0') << uint32_t(c);
+			cerr << dec << endl;
+			return false;
+		}
+	}
+
+	vector<u16string> ascii, all;
+	for (const vector<TableRow>* table : { &rows, &compoundRows }) {
+		for (const auto& row : *table) {
+			const u16string& str = row.first.mStr;
+			if (!all.empty() && all.back() == str)
+				continue;
+			all.push_back(str);
+			if (str.size() == 1 && str[0] < 0x80)
+				ascii.push_back(str);
+		}
+	}
+
+	// the same mix on every run
+	mt19937 random(1);
+	for (size_t i = 0; i < kMixSize; ++i) {
+		uint32_t kind = random() % 10;
+		TuneLookup lookup;
+		if (kind < 5)
+			lookup.mStr = ascii[random() % ascii.size()];
+		else if (kind < 9)
+			lookup.mStr = all[random() % all.size()];
+		else
+			lookup.mStr = kTuneNotOperators[random() % size(kTuneNotOperators)];
+		uint32_t form = random() % 5;
+		lookup.mForm = form < 3 ? NS_MATHML_OPERATOR_FORM_INFIX :
+			form < 4 ? NS_MATHML_OPERATOR_FORM_PREFIX : NS_MATHML_OPERATOR_FORM_POSTFIX;
+		aMix.push_back(lookup);
+	}
+	return true;
+}
+
+typedef TuneResult (*LayoutMeasure)(const vector<TableRow>& rows, const vector<TableRow>& compoundRows,
+	const vector<TuneLookup>& aMix, const vector<pair<bool, OperatorAttributes>>& aExpected);
+
+// The values of MATHML_OPERATOR_LAYOUT, with the outputs each one needs
+// besides --layout=constexpr
+static const struct {
+	string_view		name;		// for --tune-layout=
+	const char*		macro;
+	string_view		layouts[2];
+	LayoutMeasure	measure;	// null if it cannot be built in memory
+} kTuneCandidates[] = {
+	{ "sorted", "MATHML_OPERATOR_LAYOUT_SORTED", { }, MeasureLayout<TuneSortedLayout> },
+	{ "hash", "MATHML_OPERATOR_LAYOUT_HASH", { "hash" }, MeasureLayout<TuneHashLayout> },
+	{ "pagetable", "MATHML_OPERATOR_LAYOUT_PAGE_TABLE", { "pagetable" }, MeasureLayout<TunePageTableLayout> },
+	{ "columns", "MATHML_OPERATOR_LAYOUT_COLUMNS", { "columns" }, MeasureLayout<TuneColumnsLayout> },
+	{ "eytzinger", "MATHML_OPERATOR_LAYOUT_EYTZINGER", { "columns", "eytzinger" }, MeasureLayout<TuneEytzingerLayout> },
+	{ "simd", "MATHML_OPERATOR_LAYOUT_SIMD", { "columns", "simd" }, MeasureLayout<TuneSimdLayout> },
+	{ "forms", "MATHML_OPERATOR_LAYOUT_FORMS", { "forms" }, MeasureLayout<TuneFormsLayout> },
+	{ "bitmap", "MATHML_OPERATOR_LAYOUT_BITMAP", { "forms", "bitmap" }, MeasureLayout<TuneBitmapLayout> },
+	{ "packed", "MATHML_OPERATOR_LAYOUT_PACKED", { "packed" }, MeasureLayout<TunePackedLayout> },
+	{ "intervals", "MATHML_OPERATOR_LAYOUT_INTERVALS", { "forms", "intervals" }, MeasureLayout<TuneIntervalsLayout> },
+	{ "learned", "MATHML_OPERATOR_LAYOUT_LEARNED", { "columns", "learned" }, MeasureLayout<TuneLearnedLayout> },
+	// code, which only a compiler can build
+	{ "switch", "MATHML_OPERATOR_LAYOUT_SWITCH", { "switch" }, nullptr }
+};
+
+// Measures every candidate, prints the report and returns the fastest
+// one, or the one named aOverride. Returns size(kTuneCandidates) if there
+// is none to write: no candidate found what the dictionary says, or
+// aOverride did not.
+static size_t
+TuneLayout(const vector<TableRow>& rows, const vector<TableRow>& compoundRows, string_view aOverride)
+{
+	vector<TuneLookup> mix;
+	if (!TuneLookupMix(rows, compoundRows, mix))
+		return size(kTuneCandidates);
+	vector<pair<bool, OperatorAttributes>> expected;
+	for (const TuneLookup& lookup : mix) {
+		OperatorAttributes attributes = {};
+		bool found = DictionaryAttributes(lookup.mStr.size() == 1 ? rows : compoundRows, lookup, attributes);
+		expected.emplace_back(found, attributes);
+	}
+
+	// p99 is over the means of the batches of kTuneBatch lookups, and the
+	// probes are estimated from the sizes of the tables
+	cout << "layout        bytes   avg ns  p99 ns/" << kTuneBatch << "  est. probes" << endl;
+	size_t fastest = size(kTuneCandidates);
+	double fastestAverage = HUGE_VAL;
+	bool valid[size(kTuneCandidates)] = {};
+	for (size_t i = 0; i < size(kTuneCandidates); ++i) {
+		cout << left << setw(10) << kTuneCandidates[i].name << right;
+		if (!kTuneCandidates[i].measure) {
+			cout << "  not measured, generated code" << endl;
+			continue;
+		}
+		TuneResult result = kTuneCandidates[i].measure(rows, compoundRows, mix, expected);
+		cout << fixed << setprecision(1) << setw(9) << result.mBytes << setw(9) << result.mAverage
+			<< setw(12) << result.mP99 << setw(13) << result.mProbes;
+		if (!result.mValid) {
+			cout << "  wrong results, not picked" << endl;
+			continue;
+		}
+		cout << endl;
+		valid[i] = true;
+		if (result.mAverage < fastestAverage) {
+			fastest = i;
+			fastestAverage = result.mAverage;
+		}
+	}
+	cout << defaultfloat;
+
+	size_t picked = fastest;
+	for (size_t i = 0; i < size(kTuneCandidates); ++i) {
+		if (kTuneCandidates[i].name == aOverride)
+			picked = i;
+	}
+	if (picked == size(kTuneCandidates)) {
+		cerr << "no layout produced correct results" << endl;
+		return picked;
+	}
+	// the generated code cannot be checked here, but a layout that was is
+	// not written if it failed
+	if (kTuneCandidates[picked].measure && !valid[picked]) {
+		cerr << "layout " << kTuneCandidates[picked].name << " produced wrong results, not writing it" << endl;
+		return size(kTuneCandidates);
+	}
+	cout << "picked " << kTuneCandidates[picked].name << (picked == fastest ? "" : " (--tune-layout)") << endl;
+	return picked;
+}
+
+// nsMathMLOperatorLayout.h, read by nsMathMLOperators.cpp when built with
+// MATHML_OPERATOR_TUNED_LAYOUT
+static void
+WriteTunedLayout(ostream& aOut, size_t aCandidate)
+{
+	aOut << "// Generated by GenerateOperatorTable --tune from mathfont.properties." << endl
+		<< "// Do not edit; regenerate instead." << endl << endl
+		<< "#ifndef nsMathMLOperatorLayout_h___" << endl
+		<< "#define nsMathMLOperatorLayout_h___" << endl << endl
+		<< "#define MATHML_OPERATOR_LAYOUT " << kTuneCandidates[aCandidate].macro << endl << endl
+		<< "#endif /* nsMathMLOperatorLayout_h___ */" << endl;
+}
+
+// Usage: GenerateOperatorTable [--threads=N] [--bloom-fp=RATE] [--learned-error=N]
+//                              [--layout=NAME]... [--tune] [--tune-layout=NAME]
+//	--threads=N		parse the input on N threads, 0 uses every core (default 1)
+//	--bloom-fp=RATE	false positive rate of --layout=bloom (default 0.01)
+//	--learned-error=N	error bound of --layout=learned in rows (default 4)
+//	--layout=NAME	also write the tables in layout NAME (see kLayouts)
+//	--tune		time the layouts of MATHML_OPERATOR_LAYOUT, write the
+//			fastest to nsMathMLOperatorLayout.h with the tables it needs
+//	--tune-layout=NAME	as --tune, but write layout NAME (see kTuneCandidates)
+int main(int argc, char* argv[])
+{
+	unsigned threads = 1;
+	vector<size_t> layouts;
+	bool tune = false;
+	string_view tuneLayout;
+	for (int i = 1; i < argc; ++i) {
+		string_view arg(argv[i]);
+		if (0 == arg.compare(0, 10, "--threads=")) {
+			threads = static_cast<unsigned>(strtoul(argv[i] + 10, nullptr, 10));
+			if (0 == threads)
+				threads = max(1u, thread::hardware_concurrency());
+		}
+		else if (0 == arg.compare(0, 11, "--bloom-fp=")) {
+			gBloomFalsePositiveRate = strtod(argv[i] + 11, nullptr);
+		}
+		else if (0 == arg.compare(0, 16, "--learned-error=")) {
+			gLearnedMaxError = static_cast<uint32_t>(strtoul(argv[i] + 16, nullptr, 10));
+		}
+		else if (0 == arg.compare(0, 9, "--layout=")) {
+			size_t layout = 0;
+			while (layout < size(kLayouts) && kLayouts[layout].name != arg.substr(9))
+				++layout;
+			if (layout == size(kLayouts)) {
+				cerr << "unknown layout " << arg.substr(9) << endl;
+				return 1;
+			}
+			layouts.push_back(layout);
+		}
+		else if (arg == "--tune") {
+			tune = true;
+		}
+		else if (0 == arg.compare(0, 14, "--tune-layout=")) {
+			tuneLayout = arg.substr(14);
+			if (none_of(begin(kTuneCandidates), end(kTuneCandidates),
+					[&](const auto& candidate) { return candidate.name == tuneLayout; })) {
+				cerr << "unknown layout " << tuneLayout << endl;
+				return 1;
+			}
+			tune = true;
+		}
+		else {
+			cerr << "unknown option " << arg << endl;
+			return 1;
+		}
+	}
+
+	MappedFile inFile("mathfont.properties");
+	gPropertiesText = string_view(inFile.begin(), inFile.size());
+	ofstream outFile("operatorTableCode.txt");
+	vector<TableRow> compoundRows, rows;
+	if (threads > 1)
+		ParseLinesParallel(inFile.begin(), inFile.end(), threads, rows, compoundRows);
+	else
+		ParseLines(inFile.begin(), inFile.end(), rows, compoundRows);
+	size_t compoundCount = compoundRows.size(), count = rows.size();
+
+	// Sort tables
+	sort(begin(rows), end(rows));
+	sort(begin(compoundRows), end(compoundRows));
+
+	// Output tables to file
+	for (size_t i = 0; i < rows.size(); ++i)
+	{
+		outFile << rows[i].second[0];
+		if (i < rows.size() - 1) outFile << "}, //";
+		else outFile << "} //";
+		outFile << rows[i].second[1] << endl;
+	}
+	outFile << "};" << endl << endl;
+	for (size_t i = 0; i < compoundRows.size(); ++i)
+	{
+		outFile << compoundRows[i].second[0];
+		if (i < compoundRows.size() - 1) outFile << "}, //";
+		else outFile << "} //";
+		outFile << compoundRows[i].second[1] << endl;
+	}
+	outFile << "};" << endl << endl;
+
+	if (tune) {
+		size_t candidate = TuneLayout(rows, compoundRows, tuneLayout);
+		if (candidate == size(kTuneCandidates))
+			return 1;
+		// the tables the picked layout reads
+		string_view needed[] = { "constexpr", kTuneCandidates[candidate].layouts[0],
+			kTuneCandidates[candidate].layouts[1] };
+		for (string_view name : needed) {
+			for (size_t layout = 0; layout < size(kLayouts); ++layout) {
+				if (kLayouts[layout].name == name && find(begin(layouts), end(layouts), layout) == end(layouts))
+					layouts.push_back(layout);
+			}
+		}
+		ofstream layoutFile("mathML/nsMathMLOperatorLayout.h", ios::binary);
+		WriteTunedLayout(layoutFile, candidate);
+	}
+
+	for (size_t layout : layouts) {
+		// binary, so that --layout=binary is written as is and the
+		// source files get the same line ends on every platform
+		ofstream layoutFile(kLayouts[layout].path, ios::binary);
+		kLayouts[layout].emit(layoutFile, rows, compoundRows);
 	}
-	outFile << "};" << endl << endl;
 
 	cout << dec << compoundCount << " " << count;
 
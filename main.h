@@ -1,6 +1,7 @@
 #pragma once
 #include <stdint.h>
 #include <string>
+#include "mathML/nsMathMLOperatorLookup.h"
 using namespace std;
 
 #define NS_MATHML_OPERATOR_GET_FORM(_flags) \
@@ -74,28 +75,21 @@ struct OperatorData {
 
 	bool operator<(const OperatorData& B) const
 	{
-		// get values of first place operator
-		int a = static_cast<int>(static_cast<char16_t>(this->mStr[0]));
-		int b = static_cast<int>(static_cast<char16_t>(B.mStr[0]));
-		// Compare values
-		if (a < b) return true;
-		if (a > b) return false;
+		// Compare the packed code units, see OperatorCompoundKey
+		uint64_t a = OperatorCompoundKey(this->mStr.data(), static_cast<uint32_t>(this->mStr.size()));
+		uint64_t b = OperatorCompoundKey(B.mStr.data(), static_cast<uint32_t>(B.mStr.size()));
+		if (a != b) return a < b;
 		// Values tied
-		// if either value is compound
-		if (this->mStr.size()>1 || B.mStr.size()>1) {
-			// Consider next values
-			for (int i = 1; i <= 2; ++i) {
-				// if either lacks a successor value
-				// set value to 0, so that the other value takes precendence
-				if (this->mStr.size() < i + 1) a = 0;
-				else a = static_cast<int>(static_cast<char16_t>(this->mStr[i]));
-				if (B.mStr.size() < i + 1) b = 0;
-				else b = static_cast<int>(static_cast<char16_t>(B.mStr[i]));
-				// Compare values
-				if (a < b) return true;
-				if (a > b) return false;
-			}
+		// if either value spills, consider the values that follow
+		if (this->mStr.size() > kMaxPackedOperatorLength || B.mStr.size() > kMaxPackedOperatorLength) {
+			int tail = this->mStr.compare(kMaxPackedOperatorLength, u16string::npos,
+				B.mStr, kMaxPackedOperatorLength, u16string::npos);
+			if (tail) return tail < 0;
 		}
+		// Values tied
+		// trailing U+0000 pack like the end of a shorter key
+		if (this->mStr.size() != B.mStr.size())
+			return this->mStr.size() < B.mStr.size();
 		// Values tied, compare by form
 		if (rearrange[NS_MATHML_OPERATOR_GET_FORM(this->mFlags)] 
 			< rearrange[NS_MATHML_OPERATOR_GET_FORM(B.mFlags)])
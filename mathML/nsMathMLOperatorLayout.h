@@ -0,0 +1,9 @@
+// Generated by GenerateOperatorTable --tune from mathfont.properties.
+// Do not edit; regenerate instead.
+
+#ifndef nsMathMLOperatorLayout_h___
+#define nsMathMLOperatorLayout_h___
+
+#define MATHML_OPERATOR_LAYOUT MATHML_OPERATOR_LAYOUT_BITMAP
+
+#endif /* nsMathMLOperatorLayout_h___ */
@@ -0,0 +1,982 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Index computations for the generated Operator Dictionary layouts.
+// GenerateOperatorTable includes this file to build the tables it emits,
+// and nsMathMLOperators.cpp to search them, so it must stay free of
+// Gecko dependencies.
+
+#ifndef nsMathMLOperatorLookup_h___
+#define nsMathMLOperatorLookup_h___
+
+#include <stdint.h>
+#include <string.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MATHML_OPERATOR_SSE2 1
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h> // _BitScanForward
+#endif
+
+////////////////////////////////////////////////////////////////////////////
+// Minimal perfect hash over (code point, form) keys
+//
+// A key first selects a bucket; the bucket's seed then selects the slot.
+// The generator picks the seeds so that every key gets a distinct slot
+// and there are exactly as many slots as keys.
+
+static inline uint32_t
+OperatorHashKey(char16_t aChar, uint32_t aForm)
+{
+  return (uint32_t(aChar) << 2) | aForm;
+}
+
+static inline uint32_t
+OperatorHash(uint32_t aKey, uint32_t aSeed)
+{
+  uint32_t h = (aKey ^ aSeed) * 0x9E3779B1u;
+  h ^= h >> 15;
+  h *= 0x85EBCA77u;
+  h ^= h >> 13;
+  return h;
+}
+
+// maps a hash onto [0, aRange) without a division
+static inline uint32_t
+OperatorHashReduce(uint32_t aHash, uint32_t aRange)
+{
+  return uint32_t((uint64_t(aHash) * aRange) >> 32);
+}
+
+static inline uint32_t
+OperatorHashBucket(uint32_t aKey, uint32_t aSalt, uint32_t aBucketCount)
+{
+  return OperatorHashReduce(OperatorHash(aKey, aSalt), aBucketCount);
+}
+
+static inline uint32_t
+OperatorHashSlot(uint32_t        aKey,
+                 uint32_t        aSalt,
+                 const uint16_t* aSeeds,
+                 uint32_t        aBucketCount,
+                 uint32_t        aSlotCount)
+{
+  uint32_t seed = aSeeds[OperatorHashBucket(aKey, aSalt, aBucketCount)];
+  return OperatorHashReduce(OperatorHash(aKey, aSalt + seed), aSlotCount);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Two-level page table over the BMP
+//
+// The high byte of a code point selects a page, the low byte an entry of
+// that page. Page 0 is all zeros and shared by every high byte without
+// operators. A non-zero entry is one plus the index of the code point's
+// first row in the sorted table; the rows of its other forms follow it.
+
+static const uint32_t kOperatorPageSize = 256;
+
+static inline uint16_t
+OperatorPageEntry(const uint8_t*  aPageIndex,
+                  const uint16_t (*aPages)[kOperatorPageSize],
+                  char16_t        aChar)
+{
+  return aPages[aPageIndex[aChar >> 8]][aChar & 0xFF];
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Key columns
+//
+// Single character keys are their code unit. Compound keys pack their
+// first four code units, zero padded, into 64 bits, high unit first, so
+// that comparing two packed keys is comparing the strings. No operator
+// contains U+0000, so the padding encodes the length; a string searched
+// for must be checked with OperatorCanPackKey first. Longer keys spill:
+// they pack like their first four units and ties are broken by the units
+// that follow.
+
+static const uint32_t kMaxPackedOperatorLength = 4;
+
+static constexpr uint64_t
+OperatorCompoundKey(const char16_t* aStr, uint32_t aLength)
+{
+  uint64_t key = 0;
+  for (uint32_t i = 0; i < kMaxPackedOperatorLength; ++i) {
+    key = (key << 16) | (i < aLength ? aStr[i] : 0);
+  }
+  return key;
+}
+
+// False if the aLength code units at aStr have no packed key of their own:
+// they are too many, or one is U+0000, which the padding would confuse
+// with the end of a shorter key ("!=\0" packs as "!=").
+static constexpr bool
+OperatorCanPackKey(const char16_t* aStr, uint32_t aLength)
+{
+  if (aLength > kMaxPackedOperatorLength) {
+    return false;
+  }
+  for (uint32_t i = 0; i < aLength; ++i) {
+    if (0 == aStr[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Index of the first of aCount sorted keys that is not less than aKey,
+// or aCount. The loop has a fixed trip count and no data dependent
+// branches.
+template<typename Key>
+static inline uint32_t
+OperatorLowerBound(const Key* aKeys, uint32_t aCount, Key aKey)
+{
+  if (0 == aCount) {
+    return 0;
+  }
+  const Key* base = aKeys;
+  while (aCount > 1) {
+    uint32_t half = aCount / 2;
+    base = (base[half] < aKey) ? base + half : base;
+    aCount -= half;
+  }
+  return uint32_t(base - aKeys) + (*base < aKey);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Learned index over the single character key column
+//
+// A piecewise-linear model predicts the row of a key: segment s starts at
+// key aSegmentKeys[s], whose first row is aSegmentRows[s], and adds
+// aSegmentSlopes[s] rows per code point, in 16.16 fixed point. The first
+// row of every key lies within the maximum error of its prediction, so
+// only that window of the key column is searched.
+
+static inline uint32_t
+OperatorLearnedPredict(uint16_t aSegmentKey,
+                       uint16_t aSegmentRow,
+                       uint32_t aSegmentSlope,
+                       uint16_t aKey)
+{
+  return aSegmentRow +
+         uint32_t((uint64_t(aKey - aSegmentKey) * aSegmentSlope + 0x8000) >> 16);
+}
+
+// Row of the first of aCount sorted keys that equals aKey, or aCount
+static inline uint32_t
+OperatorLearnedSearch(const uint16_t* aSegmentKeys,
+                      const uint16_t* aSegmentRows,
+                      const uint32_t* aSegmentSlopes,
+                      uint32_t        aSegmentCount,
+                      uint32_t        aMaxError,
+                      const uint16_t* aKeys,
+                      uint32_t        aCount,
+                      uint16_t        aKey)
+{
+  // the last segment starting at or before aKey
+  uint32_t s = OperatorLowerBound(aSegmentKeys, aSegmentCount, aKey);
+  if (s == aSegmentCount || aSegmentKeys[s] != aKey) {
+    if (0 == s) {
+      return aCount;
+    }
+    --s;
+  }
+  uint32_t predicted = OperatorLearnedPredict(aSegmentKeys[s], aSegmentRows[s],
+                                              aSegmentSlopes[s], aKey);
+  uint32_t first = predicted > aMaxError ? predicted - aMaxError : 0;
+  uint32_t end = predicted + aMaxError + 1;
+  if (end > aCount) {
+    end = aCount;
+  }
+  if (first >= end) {
+    return aCount;
+  }
+  uint32_t row = first + OperatorLowerBound(aKeys + first, end - first, aKey);
+  return (row < aCount && aKeys[row] == aKey) ? row : aCount;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Eytzinger (breadth-first) key columns
+//
+// Node k of the implicit search tree has children 2k and 2k+1; index 0
+// is unused. Descending the tree reads the keys of the next levels from
+// the same few cache lines, so they are prefetched ahead of the search.
+
+#if defined(__GNUC__)
+#define MATHML_OPERATOR_PREFETCH(_ptr) __builtin_prefetch(_ptr)
+#else
+#define MATHML_OPERATOR_PREFETCH(_ptr) ((void)0)
+#endif
+
+// Node of the first of aCount keys that is not less than aKey, or 0
+template<typename Key>
+static inline uint32_t
+OperatorEytzingerLowerBound(const Key* aKeys, uint32_t aCount, Key aKey)
+{
+  uint32_t k = 1;
+  while (k <= aCount) {
+    // the descendants four or more levels down share a cache line
+    MATHML_OPERATOR_PREFETCH(aKeys + k * (64 / sizeof(Key)));
+    k = 2 * k + (aKeys[k] < aKey);
+  }
+  // undo the right turns taken since the last left turn, and that turn
+#if defined(__GNUC__)
+  return k >> (__builtin_ctz(~k) + 1);
+#else
+  while (k & 1) {
+    k >>= 1;
+  }
+  return k >> 1;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Blocked key column for vector scans
+//
+// The sorted single character keys are split into blocks of
+// kOperatorKeyBlock, the last one padded with 0xFFFF. A summary column
+// holds the last key of every block; the first block whose last key is
+// not less than the key searched holds its first row, if any.
+
+static const uint32_t kOperatorKeyBlock = 16;
+
+// Position of the first of the kOperatorKeyBlock keys at aBlock that
+// equals aKey, or kOperatorKeyBlock
+static inline uint32_t
+OperatorBlockFind(const uint16_t* aBlock, uint16_t aKey)
+{
+#if defined(__AVX2__)
+  __m256i keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aBlock));
+  __m256i equal = _mm256_cmpeq_epi16(keys, _mm256_set1_epi16(int16_t(aKey)));
+  // two mask bits per key
+  uint32_t mask = uint32_t(_mm256_movemask_epi8(equal));
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long first;
+  return _BitScanForward(&first, mask) ? uint32_t(first) / 2 : kOperatorKeyBlock;
+#else
+  return mask ? uint32_t(__builtin_ctz(mask)) / 2 : kOperatorKeyBlock;
+#endif
+#elif defined(MATHML_OPERATOR_SSE2)
+  __m128i key = _mm_set1_epi16(int16_t(aKey));
+  __m128i low = _mm_cmpeq_epi16(
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(aBlock)), key);
+  __m128i high = _mm_cmpeq_epi16(
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(aBlock + 8)), key);
+  // saturating the 0 / -1 words to bytes gives one mask bit per key
+  uint32_t mask = uint32_t(_mm_movemask_epi8(_mm_packs_epi16(low, high)));
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long first;
+  return _BitScanForward(&first, mask) ? uint32_t(first) : kOperatorKeyBlock;
+#else
+  return mask ? uint32_t(__builtin_ctz(mask)) : kOperatorKeyBlock;
+#endif
+#else
+  for (uint32_t i = 0; i < kOperatorKeyBlock; ++i) {
+    if (aBlock[i] == aKey) {
+      return i;
+    }
+  }
+  return kOperatorKeyBlock;
+#endif
+}
+
+// Row of the first of the blocked keys that equals aKey, or aCount
+static inline uint32_t
+OperatorBlockSearch(const uint16_t* aBlockLastKeys,
+                    const uint16_t* aBlockedKeys,
+                    uint32_t        aCount,
+                    uint16_t        aKey)
+{
+  uint32_t blockCount = (aCount + kOperatorKeyBlock - 1) / kOperatorKeyBlock;
+  uint32_t block = OperatorLowerBound(aBlockLastKeys, blockCount, aKey);
+  if (block == blockCount) {
+    return aCount;
+  }
+  const uint16_t* keys = aBlockedKeys + block * kOperatorKeyBlock;
+  uint32_t i = OperatorBlockFind(keys, aKey);
+  return i < kOperatorKeyBlock ? block * kOperatorKeyBlock + i : aCount;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Character trie over the compound operators
+//
+// Nodes are numbered breadth first from the root, node 0, so the children
+// of a node are consecutive and sorted by the code unit leading to them,
+// which is stored at the child's index of the label column. A node ends
+// mRowCount > 0 keys; its rows hold one form each, in order of preference.
+
+struct OperatorTrieNode {
+  uint16_t mFirstChild;
+  uint16_t mFirstRow;
+  uint8_t  mChildCount;
+  uint8_t  mRowCount;
+};
+
+// Node reached by the code units of aStr, or 0 if there is none
+static inline uint32_t
+OperatorTrieWalk(const OperatorTrieNode* aNodes,
+                 const char16_t*         aLabels,
+                 const char16_t*         aStr,
+                 uint32_t                aLength)
+{
+  uint32_t node = 0;
+  for (uint32_t i = 0; i < aLength; ++i) {
+    const OperatorTrieNode& parent = aNodes[node];
+    uint32_t child = parent.mFirstChild +
+      OperatorLowerBound(aLabels + parent.mFirstChild, parent.mChildCount, aStr[i]);
+    if (child == uint32_t(parent.mFirstChild + parent.mChildCount) ||
+        aLabels[child] != aStr[i]) {
+      return 0;
+    }
+    node = child;
+  }
+  return node;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// All the forms of one operator in a single record
+//
+// Arrays are indexed by form (1 infix, 2 prefix, 3 postfix); entries of
+// forms the operator does not have are zero. mFallback holds, two bits
+// per requested form, the form to use in its place: the form itself if
+// listed, else the first of infix, postfix, prefix that is.
+
+struct OperatorForms {
+  uint8_t  mForms;       // bit f is set if form f is listed
+  uint8_t  mFallback;
+  uint8_t  mSpacing[4];  // lspace in the low nibble, rspace in the high one
+  uint16_t mFlags[4];
+};
+
+static inline uint32_t
+OperatorFormFor(const OperatorForms& aForms, uint32_t aForm)
+{
+  return (aForms.mFallback >> (2 * aForm)) & 0x3;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Intervals of code points
+//
+// Consecutive single character operators whose records above are equal
+// form one interval [first, last], which points to the shared record, its
+// attribute class. Intervals are disjoint and sorted.
+
+// Interval holding aChar among aCount intervals, or aCount
+static inline uint32_t
+OperatorIntervalSearch(const uint16_t* aFirsts,
+                       const uint16_t* aLasts,
+                       uint32_t        aCount,
+                       char16_t        aChar)
+{
+  uint32_t i = OperatorLowerBound(aLasts, aCount, uint16_t(aChar));
+  if (i == aCount || aFirsts[i] > aChar) {
+    return aCount;
+  }
+  return i;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Sub-tables of one form
+//
+// The rows of a single form as sorted key, flags and spacing columns, so
+// that a search for a form known at compile time compares keys and
+// nothing else. The generator emits them in arrays indexed by form
+// (1 infix, 2 prefix, 3 postfix), whose entry 0 is empty.
+
+template<typename Key>
+struct OperatorFormTable {
+  const Key*      mKeys;
+  const uint16_t* mFlags;
+  const uint8_t*  mSpacing;  // lspace in the low nibble, rspace in the high one
+  uint32_t        mCount;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Packed attributes
+//
+// All the attributes of a row in 32 bits, stored apart from its key:
+// bits 0-12 are the dictionary bits of the operator flags (form,
+// direction and properties), as the NS_MATHML_OPERATOR_* macros expect
+// them, bits 13-15 lspace and bits 16-18 rspace, in em.
+
+static const uint32_t kOperatorPackedFlagsMask = 0x1FFF;
+static const uint32_t kOperatorPackedSpaceMask = 0x7;
+static const uint32_t kOperatorPackedLeadingSpaceShift = 13;
+static const uint32_t kOperatorPackedTrailingSpaceShift = 16;
+
+// False if the attributes do not fit the packed record
+static constexpr bool
+OperatorCanPackAttributes(uint32_t aFlags, uint32_t aLeadingSpace, uint32_t aTrailingSpace)
+{
+  return !(aFlags & ~kOperatorPackedFlagsMask) &&
+         aLeadingSpace <= kOperatorPackedSpaceMask &&
+         aTrailingSpace <= kOperatorPackedSpaceMask;
+}
+
+static constexpr uint32_t
+OperatorPackAttributes(uint32_t aFlags, uint32_t aLeadingSpace, uint32_t aTrailingSpace)
+{
+  return (aFlags & kOperatorPackedFlagsMask) |
+         (aLeadingSpace & kOperatorPackedSpaceMask) << kOperatorPackedLeadingSpaceShift |
+         (aTrailingSpace & kOperatorPackedSpaceMask) << kOperatorPackedTrailingSpaceShift;
+}
+
+static inline uint32_t
+OperatorPackedFlags(uint32_t aAttributes)
+{
+  return aAttributes & kOperatorPackedFlagsMask;
+}
+
+static inline uint32_t
+OperatorPackedForm(uint32_t aAttributes)
+{
+  return aAttributes & 0x3;
+}
+
+static inline uint8_t
+OperatorPackedLeadingSpace(uint32_t aAttributes)
+{
+  return (aAttributes >> kOperatorPackedLeadingSpaceShift) & kOperatorPackedSpaceMask;
+}
+
+static inline uint8_t
+OperatorPackedTrailingSpace(uint32_t aAttributes)
+{
+  return (aAttributes >> kOperatorPackedTrailingSpaceShift) & kOperatorPackedSpaceMask;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Rank directory over a presence bitmap of the BMP
+//
+// Bit c of the bitmap is set if code point c is a single character
+// operator. The directory holds, for every 64 bit word of the bitmap, the
+// number of bits set in the words before it, so the rank of a set bit,
+// the dense index of its operator, takes one load and a popcount.
+
+static const uint32_t kOperatorBitmapWords = 0x10000 / 64;
+
+static inline uint32_t
+OperatorPopCount(uint64_t aWord)
+{
+#if defined(__GNUC__)
+  return uint32_t(__builtin_popcountll(aWord));
+#else
+  aWord -= (aWord >> 1) & 0x5555555555555555ull;
+  aWord = (aWord & 0x3333333333333333ull) + ((aWord >> 2) & 0x3333333333333333ull);
+  aWord = (aWord + (aWord >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+  return uint32_t((aWord * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// Dense index of aChar, or -1 if its bit is not set
+static inline int32_t
+OperatorBitmapRank(const uint64_t* aBitmap, const uint16_t* aRanks, char16_t aChar)
+{
+  uint64_t word = aBitmap[aChar >> 6];
+  uint64_t bit = uint64_t(1) << (aChar & 63);
+  if (!(word & bit)) {
+    return -1;
+  }
+  return int32_t(aRanks[aChar >> 6] + OperatorPopCount(word & (bit - 1)));
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Searches of the layouts
+//
+// A lookup finds the attributes of a key under the desired form, or next
+// form in line: the first of infix, postfix, prefix that is listed, as
+// the MathML REC says. The searches take the tables of their layout as
+// arguments: nsMathMLOperators.cpp passes its generated tables, and
+// GenerateOperatorTable --tune the ones it builds in memory.
+
+// attributes of the entry found by a lookup
+struct OperatorAttributes {
+  uint32_t mFlags;
+  uint8_t  mLeadingSpace;   // unit is em
+  uint8_t  mTrailingSpace;  // unit is em
+};
+
+// the forms in order of preference: infix, postfix, prefix
+static const uint32_t kOperatorFormFallback[] = { 1, 3, 2 };
+
+// form bits of operator flags, as NS_MATHML_OPERATOR_GET_FORM
+static inline uint32_t
+OperatorFlagsForm(uint32_t aFlags)
+{
+  return aFlags & 0x3;
+}
+
+// Row of the sorted tables of --layout=constexpr, whose keys have up to
+// Length code units. A literal type, so that the tables are
+// constant-initialized and need neither relocations nor static
+// constructors.
+template<uint32_t Length>
+struct OperatorRow {
+  static_assert(Length <= kMaxPackedOperatorLength,
+                "OperatorRow::operator< compares packed keys");
+
+  char16_t mStr[Length];        // zero padded
+  uint8_t  mLength;
+  uint8_t  mLeadingSpace : 4;   // unit is em
+  uint8_t  mTrailingSpace : 4;  // unit is em
+  uint32_t mFlags;
+
+  bool Equals(const OperatorRow& B) const
+  {
+    return mLength == B.mLength &&
+           !memcmp(mStr, B.mStr, Length * sizeof(char16_t));
+  }
+
+  bool operator<(const OperatorRow& B) const
+  {
+    // keys are zero padded, so a missing successor value
+    // compares as 0 and the other value takes precedence:
+    // a single comparison of the packed keys
+    uint64_t a = OperatorCompoundKey(mStr, Length);
+    uint64_t b = OperatorCompoundKey(B.mStr, Length);
+    // unless trailing U+0000 make a longer string pack as a shorter one
+    return a < b || (a == b && mLength < B.mLength);
+  }
+};
+
+// Find matching operator with matching form, or next form
+template<typename Row>
+static const Row*
+SequentialOpSearch(const Row* opTable,
+                   const Row& aOperator,
+                   uint16_t ndx, uint16_t size)
+{
+  uint16_t left = ndx;
+  // Check current and up to 2 forward operators for matching form
+  for (uint8_t i = 0; i <= 2 && ndx + i < size; ++i) {
+    // if current operator is the same as target operator
+    if (aOperator.Equals(opTable[ndx + i])) {
+      // if forms match
+      if (OperatorFlagsForm(aOperator.mFlags) ==
+          OperatorFlagsForm(opTable[ndx + i].mFlags)) {
+        return &opTable[ndx + i];
+      }
+    } else {
+      break;
+    }
+  }
+  // Check up to 2 operators behind
+  for (uint8_t i = 1; i <= 2 && ndx - i >= 0; ++i) {
+    // if current operator is the same as target operator
+    if (aOperator.Equals(opTable[ndx - i])) {
+      // if forms match
+      if (OperatorFlagsForm(aOperator.mFlags) ==
+          OperatorFlagsForm(opTable[ndx - i].mFlags)) {
+        return &opTable[ndx - i];
+      }
+      left = ndx - i;
+    } else {
+      break;
+    }
+  }
+  // take leftmost matching operator ( forms are in sorted order )
+  return &opTable[left];
+}
+
+// Binary search appropriate table.
+template<typename Row>
+static const Row*
+OperatorSearch(const Row* opTable,
+               const Row& aOperator,
+               int16_t f, int16_t l, uint16_t size)
+{
+  auto mid = f + (l - f) / 2;
+  if (f <= l) {
+    if (aOperator < opTable[mid]) {
+      return OperatorSearch(opTable, aOperator, f, mid - 1, size);
+    }
+    if (opTable[mid] < aOperator) {
+      return OperatorSearch(opTable, aOperator, mid + 1, l, size);
+    }
+    // current operator is a match
+    // sequential search for desired form, or next form in line
+    return SequentialOpSearch(opTable, aOperator, mid, size);
+  }
+  // not found
+  return nullptr;
+}
+
+// Search of aCount sorted rows for the aLength code units at aStr, at
+// most Length, with the desired form, or next form in line
+template<uint32_t Length>
+static const OperatorRow<Length>*
+OperatorRowSearch(const OperatorRow<Length>* aRows,
+                  uint16_t                   aCount,
+                  const char16_t*            aStr,
+                  uint32_t                   aLength,
+                  uint32_t                   aForm)
+{
+  // create dummy operator to search for
+  OperatorRow<Length> dummy = {};
+  memcpy(dummy.mStr, aStr, aLength * sizeof(char16_t));
+  dummy.mLength = uint8_t(aLength);
+  dummy.mFlags = aForm;
+  return OperatorSearch(aRows, dummy, 0, aCount - 1, aCount);
+}
+
+// One probe of the perfect hash: the slot of (aChar, aForm) holds
+// that operator, unless the operator is not in the dictionary.
+template<typename Row>
+static inline const Row*
+OperatorHashProbe(const Row*      aSlots,
+                  uint32_t        aSalt,
+                  const uint16_t* aSeeds,
+                  uint32_t        aBucketCount,
+                  uint32_t        aSlotCount,
+                  char16_t        aChar,
+                  uint32_t        aForm)
+{
+  uint32_t slot = OperatorHashSlot(OperatorHashKey(aChar, aForm), aSalt,
+                                   aSeeds, aBucketCount, aSlotCount);
+  const Row& entry = aSlots[slot];
+  if (entry.mStr[0] == aChar && OperatorFlagsForm(entry.mFlags) == aForm) {
+    return &entry;
+  }
+  return nullptr;
+}
+
+// Hash lookup of a single character operator with the desired form,
+// or next form in line
+template<typename Row>
+static inline const Row*
+OperatorHashSearch(const Row*      aSlots,
+                   uint32_t        aSalt,
+                   const uint16_t* aSeeds,
+                   uint32_t        aBucketCount,
+                   uint32_t        aSlotCount,
+                   char16_t        aChar,
+                   uint32_t        aForm)
+{
+  const Row* found = OperatorHashProbe(aSlots, aSalt, aSeeds, aBucketCount,
+                                       aSlotCount, aChar, aForm);
+  for (uint32_t fallback : kOperatorFormFallback) {
+    if (!found && fallback != aForm) {
+      found = OperatorHashProbe(aSlots, aSalt, aSeeds, aBucketCount,
+                                aSlotCount, aChar, fallback);
+    }
+  }
+  return found;
+}
+
+// Page table lookup of a single character operator with the desired form,
+// or next form in line, among the aCount sorted rows the entries point to
+template<typename Row>
+static inline const Row*
+OperatorPageSearch(const uint8_t*  aPageIndex,
+                   const uint16_t (*aPages)[kOperatorPageSize],
+                   const Row*      aRows,
+                   uint32_t        aCount,
+                   char16_t        aChar,
+                   uint32_t        aForm)
+{
+  uint16_t entry = OperatorPageEntry(aPageIndex, aPages, aChar);
+  if (0 == entry) {
+    return nullptr;
+  }
+  // the forms of aChar follow each other in order of preference
+  const Row* first = &aRows[entry - 1];
+  const Row* end = aRows + aCount;
+  for (const Row* cur = first; cur < end && cur->mStr[0] == aChar; ++cur) {
+    if (OperatorFlagsForm(cur->mFlags) == aForm) {
+      return cur;
+    }
+  }
+  return first;
+}
+
+// Pick the desired form, or next form in line, among the rows of a key
+// starting at aFirst in sorted columns. The flags and spacing columns
+// are only read for these rows.
+template<typename Key>
+static inline void
+SelectOperatorForm(const Key*          aKeys,
+                   const uint16_t*     aFlags,
+                   const uint8_t*      aSpacing,
+                   uint32_t            aCount,
+                   uint32_t            aFirst,
+                   uint32_t            aForm,
+                   OperatorAttributes* aResult)
+{
+  // the forms of a key follow each other in order of preference
+  uint32_t found = aFirst;
+  for (uint32_t i = aFirst; i < aCount && aKeys[i] == aKeys[aFirst]; ++i) {
+    if (OperatorFlagsForm(aFlags[i]) == aForm) {
+      found = i;
+      break;
+    }
+  }
+  aResult->mFlags = aFlags[found];
+  aResult->mLeadingSpace = aSpacing[found] & 0xF;
+  aResult->mTrailingSpace = aSpacing[found] >> 4;
+}
+
+// Search of a sorted key column for aKey with the desired form, or next
+// form in line
+template<typename Key>
+static inline bool
+OperatorColumnSearch(const Key*          aKeys,
+                     const uint16_t*     aFlags,
+                     const uint8_t*      aSpacing,
+                     uint32_t            aCount,
+                     Key                 aKey,
+                     uint32_t            aForm,
+                     OperatorAttributes* aResult)
+{
+  uint32_t first = OperatorLowerBound(aKeys, aCount, aKey);
+  if (first == aCount || aKeys[first] != aKey) {
+    return false;
+  }
+  SelectOperatorForm(aKeys, aFlags, aSpacing, aCount, first, aForm, aResult);
+  return true;
+}
+
+// Search of an Eytzinger key column for aKey with the desired form, or
+// next form in line. aNodeRows maps the node found to its sorted row.
+template<typename Key>
+static inline bool
+OperatorEytzingerSearch(const Key*          aNodeKeys,
+                        const uint16_t*     aNodeRows,
+                        const Key*          aKeys,
+                        const uint16_t*     aFlags,
+                        const uint8_t*      aSpacing,
+                        uint32_t            aCount,
+                        Key                 aKey,
+                        uint32_t            aForm,
+                        OperatorAttributes* aResult)
+{
+  uint32_t node = OperatorEytzingerLowerBound(aNodeKeys, aCount, aKey);
+  if (0 == node || aNodeKeys[node] != aKey) {
+    return false;
+  }
+  SelectOperatorForm(aKeys, aFlags, aSpacing, aCount, aNodeRows[node], aForm, aResult);
+  return true;
+}
+
+// Vector scan for a single character operator with the desired form, or
+// next form in line. The block summary narrows the search to sixteen
+// keys, which are compared at once.
+static inline bool
+OperatorBlockColumnSearch(const uint16_t*     aBlockLastKeys,
+                          const uint16_t*     aBlockedKeys,
+                          const uint16_t*     aKeys,
+                          const uint16_t*     aFlags,
+                          const uint8_t*      aSpacing,
+                          uint32_t            aCount,
+                          char16_t            aChar,
+                          uint32_t            aForm,
+                          OperatorAttributes* aResult)
+{
+  uint32_t first = OperatorBlockSearch(aBlockLastKeys, aBlockedKeys, aCount, uint16_t(aChar));
+  if (first == aCount) {
+    return false;
+  }
+  SelectOperatorForm(aKeys, aFlags, aSpacing, aCount, first, aForm, aResult);
+  return true;
+}
+
+// Learned index lookup of a single character operator with the desired
+// form, or next form in line: the model predicts the row of aChar, and
+// only the rows within its error are searched.
+static inline bool
+OperatorLearnedColumnSearch(const uint16_t*     aSegmentKeys,
+                            const uint16_t*     aSegmentRows,
+                            const uint32_t*     aSegmentSlopes,
+                            uint32_t            aSegmentCount,
+                            uint32_t            aMaxError,
+                            const uint16_t*     aKeys,
+                            const uint16_t*     aFlags,
+                            const uint8_t*      aSpacing,
+                            uint32_t            aCount,
+                            char16_t            aChar,
+                            uint32_t            aForm,
+                            OperatorAttributes* aResult)
+{
+  uint32_t first = OperatorLearnedSearch(aSegmentKeys, aSegmentRows, aSegmentSlopes,
+                                         aSegmentCount, aMaxError, aKeys, aCount,
+                                         uint16_t(aChar));
+  if (first == aCount) {
+    return false;
+  }
+  SelectOperatorForm(aKeys, aFlags, aSpacing, aCount, first, aForm, aResult);
+  return true;
+}
+
+// Search of a sorted key column for aKey with the desired form, or next
+// form in line. Each row has its attributes in a single packed word.
+template<typename Key>
+static inline bool
+OperatorPackedSearch(const Key*          aKeys,
+                     const uint32_t*     aAttributes,
+                     uint32_t            aCount,
+                     Key                 aKey,
+                     uint32_t            aForm,
+                     OperatorAttributes* aResult)
+{
+  uint32_t first = OperatorLowerBound(aKeys, aCount, aKey);
+  if (first == aCount || aKeys[first] != aKey) {
+    return false;
+  }
+  // the forms of a key follow each other in order of preference
+  uint32_t found = first;
+  for (uint32_t i = first; i < aCount && aKeys[i] == aKey; ++i) {
+    if (OperatorPackedForm(aAttributes[i]) == aForm) {
+      found = i;
+      break;
+    }
+  }
+  aResult->mFlags = OperatorPackedFlags(aAttributes[found]);
+  aResult->mLeadingSpace = OperatorPackedLeadingSpace(aAttributes[found]);
+  aResult->mTrailingSpace = OperatorPackedTrailingSpace(aAttributes[found]);
+  return true;
+}
+
+// Record of aKey in a sorted key column of OperatorForms records, or null
+template<typename Key>
+static inline const OperatorForms*
+OperatorFormsSearch(const Key*           aKeys,
+                    const OperatorForms* aRecords,
+                    uint32_t             aCount,
+                    Key                  aKey)
+{
+  uint32_t i = OperatorLowerBound(aKeys, aCount, aKey);
+  if (i == aCount || aKeys[i] != aKey) {
+    return nullptr;
+  }
+  return &aRecords[i];
+}
+
+// Record of aChar through the bitmap and its rank directory, or null
+static inline const OperatorForms*
+OperatorBitmapFormsSearch(const uint64_t*      aBitmap,
+                          const uint16_t*      aRanks,
+                          const OperatorForms* aRecords,
+                          char16_t             aChar)
+{
+  // a single bit test rejects the code points that are not operators
+  int32_t rank = OperatorBitmapRank(aBitmap, aRanks, aChar);
+  return rank < 0 ? nullptr : &aRecords[rank];
+}
+
+// Record shared by the interval of aChar among aCount intervals, or null
+static inline const OperatorForms*
+OperatorIntervalFormsSearch(const uint16_t*      aFirsts,
+                            const uint16_t*      aLasts,
+                            const uint8_t*       aClasses,
+                            const OperatorForms* aClassRecords,
+                            uint32_t             aCount,
+                            char16_t             aChar)
+{
+  uint32_t i = OperatorIntervalSearch(aFirsts, aLasts, aCount, aChar);
+  return i == aCount ? nullptr : &aClassRecords[aClasses[i]];
+}
+
+// Attributes of the desired form, or next form in line, of a record; the
+// fallback form was chosen by the generator
+static inline void
+SelectOperatorForms(const OperatorForms& aForms,
+                    uint32_t             aForm,
+                    OperatorAttributes*  aResult)
+{
+  uint32_t form = OperatorFormFor(aForms, aForm);
+  aResult->mFlags = aForms.mFlags[form];
+  aResult->mLeadingSpace = aForms.mSpacing[form] & 0xF;
+  aResult->mTrailingSpace = aForms.mSpacing[form] >> 4;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Bloom filter over the compound operators
+//
+// Most multi-character <mo> are words such as "sin", which a lookup can
+// reject before searching. The k bits of a string are derived from one
+// 64 bit hash by double hashing; the generator sizes the filter for the
+// false positive rate it is given.
+
+static inline uint64_t
+OperatorStringHash(const char16_t* aStr, uint32_t aLength)
+{
+  uint64_t h = 0xCBF29CE484222325ull ^ aLength;
+  for (uint32_t i = 0; i < aLength; ++i) {
+    h = (h ^ aStr[i]) * 0x100000001B3ull;
+  }
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDull;
+  h ^= h >> 33;
+  return h;
+}
+
+// Bit of the i-th of the hashes of aHash, in a filter of aBitCount bits
+static inline uint32_t
+OperatorBloomBit(uint64_t aHash, uint32_t aIndex, uint32_t aBitCount)
+{
+  uint32_t h1 = uint32_t(aHash), h2 = uint32_t(aHash >> 32) | 1;
+  return OperatorHashReduce(h1 + aIndex * h2, aBitCount);
+}
+
+// False if aStr is certainly not one of the keys of the filter
+static inline bool
+OperatorBloomMayContain(const uint64_t* aBits,
+                        uint32_t        aBitCount,
+                        uint32_t        aHashCount,
+                        const char16_t* aStr,
+                        uint32_t        aLength)
+{
+  uint64_t hash = OperatorStringHash(aStr, aLength);
+  for (uint32_t i = 0; i < aHashCount; ++i) {
+    uint32_t bit = OperatorBloomBit(hash, i, aBitCount);
+    if (!(aBits[bit >> 6] & (uint64_t(1) << (bit & 63)))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Binary Operator Dictionary
+//
+// The file written by GenerateOperatorTable --layout=binary, meant to be
+// mapped and searched in place. It holds the columns of --layout=columns
+// at the offsets given by its header, each aligned on the size of its
+// elements. Integers are little endian.
+
+static const uint32_t kOperatorDictionaryMagic = 0x4F4C4D4D; // "MMLO"
+static const uint16_t kOperatorDictionaryVersion = 1;
+
+struct OperatorDictionaryHeader {
+  uint32_t mMagic;
+  uint16_t mVersion;
+  uint16_t mHeaderSize;       // sizeof(OperatorDictionaryHeader)
+  uint32_t mFileSize;
+  uint32_t mChecksum;         // of the bytes following the header
+  uint32_t mCount;            // single character rows
+  uint32_t mCompoundCount;    // compound rows
+  // offsets of the columns from the start of the file
+  uint32_t mKeys;             // uint16_t[mCount]
+  uint32_t mFlags;            // uint16_t[mCount]
+  uint32_t mSpacing;          // uint8_t[mCount]
+  uint32_t mCompoundKeys;     // uint64_t[mCompoundCount], see OperatorCompoundKey
+  uint32_t mCompoundFlags;    // uint16_t[mCompoundCount]
+  uint32_t mCompoundSpacing;  // uint8_t[mCompoundCount]
+};
+
+// 32 bit FNV-1a
+static inline uint32_t
+OperatorDictionaryChecksum(const uint8_t* aData, uint32_t aSize)
+{
+  uint32_t h = 0x811C9DC5u;
+  for (uint32_t i = 0; i < aSize; ++i) {
+    h = (h ^ aData[i]) * 0x01000193u;
+  }
+  return h;
+}
+
+#endif /* nsMathMLOperatorLookup_h___ */
@@ -0,0 +1,359 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Compile-time parser of mathfont.properties.
+// It follows ScanOperatorKey, SetOperator, SetBooleanProperty and
+// SetProperty of GenerateOperatorTable line for line, quirks included,
+// and sorts the rows like OperatorData::operator< in main.h, so that
+// nsMathMLOperators.cpp can check that the generated tables are those of
+// the properties it is built with. The includer provides the
+// NS_MATHML_OPERATOR_* flags.
+
+#ifndef nsMathMLOperatorParser_h___
+#define nsMathMLOperatorParser_h___
+
+#include <stddef.h>
+#include <stdint.h>
+#include "nsMathMLOperatorLookup.h"
+
+struct ParsedOperator {
+  uint64_t mKey = 0;          // OperatorCompoundKey of the code units
+  uint8_t  mLength = 0;
+  uint8_t  mLeadingSpace = 0;
+  uint8_t  mTrailingSpace = 0;
+  uint32_t mFlags = 0;
+};
+
+template<size_t N>
+struct ParsedOperatorTable {
+  ParsedOperator mRows[N > 0 ? N : 1] = {};
+  size_t mCount = 0;
+  // more than N rows, or keys too long for OperatorCompoundKey
+  bool mOverflow = false;
+
+  constexpr void Append(const ParsedOperator& aRow)
+  {
+    if (mCount == N) {
+      mOverflow = true;
+      return;
+    }
+    mRows[mCount++] = aRow;
+  }
+};
+
+template<size_t Count, size_t CompoundCount>
+struct ParsedOperatorTables {
+  ParsedOperatorTable<Count> mOperators;
+  ParsedOperatorTable<CompoundCount> mCompoundOperators;
+};
+
+// True if [aBegin, aEnd) spells the null-terminated aLiteral
+static constexpr bool
+OperatorTextEquals(const char* aBegin, const char* aEnd, const char* aLiteral)
+{
+  for (; aBegin != aEnd; ++aBegin, ++aLiteral) {
+    if (!*aLiteral || *aBegin != *aLiteral) {
+      return false;
+    }
+  }
+  return !*aLiteral;
+}
+
+static constexpr bool
+OperatorTextIsSpace(char aChar)
+{
+  return aChar == ' ' || aChar == '\t' || aChar == '\n' ||
+         aChar == '\v' || aChar == '\f' || aChar == '\r';
+}
+
+// OperatorData::operator< of main.h on packed keys
+static constexpr bool
+ParsedOperatorLess(const ParsedOperator& aA, const ParsedOperator& aB)
+{
+  constexpr int rearrange[] = { 0, 1, 3, 2 };
+  if (aA.mKey != aB.mKey) {
+    return aA.mKey < aB.mKey;
+  }
+  return rearrange[aA.mFlags & NS_MATHML_OPERATOR_FORM] <
+         rearrange[aB.mFlags & NS_MATHML_OPERATOR_FORM];
+}
+
+// Bottom-up merge sort: std::sort is not constexpr in C++17
+template<size_t N>
+static constexpr void
+SortParsedOperators(ParsedOperatorTable<N>& aTable)
+{
+  ParsedOperator merged[N > 0 ? N : 1] = {};
+  for (size_t width = 1; width < aTable.mCount; width *= 2) {
+    for (size_t left = 0; left < aTable.mCount; left += 2 * width) {
+      size_t middle = left + width < aTable.mCount ? left + width : aTable.mCount;
+      size_t right = middle + width < aTable.mCount ? middle + width : aTable.mCount;
+      size_t i = left, j = middle, k = left;
+      while (i < middle && j < right) {
+        merged[k++] = ParsedOperatorLess(aTable.mRows[j], aTable.mRows[i])
+                      ? aTable.mRows[j++] : aTable.mRows[i++];
+      }
+      while (i < middle) {
+        merged[k++] = aTable.mRows[i++];
+      }
+      while (j < right) {
+        merged[k++] = aTable.mRows[j++];
+      }
+    }
+    for (size_t i = 0; i < aTable.mCount; ++i) {
+      aTable.mRows[i] = merged[i];
+    }
+  }
+}
+
+// SetProperty: direction, lspace and rspace
+static constexpr void
+SetParsedProperty(ParsedOperator& aOperator,
+                  const char* aName, const char* aNameEnd,
+                  const char* aValue, const char* aValueEnd)
+{
+  if (aName == aNameEnd || aValue == aValueEnd) {
+    return;
+  }
+  if (OperatorTextEquals(aName, aNameEnd, "direction")) {
+    if (OperatorTextEquals(aValue, aValueEnd, "vertical")) {
+      aOperator.mFlags |= NS_MATHML_OPERATOR_DIRECTION_VERTICAL;
+    } else if (OperatorTextEquals(aValue, aValueEnd, "horizontal")) {
+      aOperator.mFlags |= NS_MATHML_OPERATOR_DIRECTION_HORIZONTAL;
+    }
+    return;
+  }
+  bool isLeadingSpace = OperatorTextEquals(aName, aNameEnd, "lspace");
+  if (!isLeadingSpace && !OperatorTextEquals(aName, aNameEnd, "rspace")) {
+    return;
+  }
+  // stoi, stored in a 4 bit field
+  const char* c = aValue;
+  while (c != aValueEnd && OperatorTextIsSpace(*c)) {
+    ++c;
+  }
+  bool negative = c != aValueEnd && *c == '-';
+  if (c != aValueEnd && (*c == '-' || *c == '+')) {
+    ++c;
+  }
+  int space = 0;
+  for (; c != aValueEnd && '0' <= *c && *c <= '9'; ++c) {
+    space = 10 * space + (*c - '0');
+  }
+  uint8_t field = uint8_t(negative ? -space : space) & 0xF;
+  if (isLeadingSpace) {
+    aOperator.mLeadingSpace = field;
+  } else {
+    aOperator.mTrailingSpace = field;
+  }
+}
+
+// SetBooleanProperty
+static constexpr void
+SetParsedBooleanProperty(ParsedOperator& aOperator,
+                         const char* aName, const char* aNameEnd)
+{
+  if (aName == aNameEnd) {
+    return;
+  }
+  if (OperatorTextEquals(aName, aNameEnd, "stretchy") && 1 == aOperator.mLength) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_STRETCHY;
+  } else if (OperatorTextEquals(aName, aNameEnd, "fence")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_FENCE;
+  } else if (OperatorTextEquals(aName, aNameEnd, "accent")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_ACCENT;
+  } else if (OperatorTextEquals(aName, aNameEnd, "largeop")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_LARGEOP;
+  } else if (OperatorTextEquals(aName, aNameEnd, "separator")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_SEPARATOR;
+  } else if (OperatorTextEquals(aName, aNameEnd, "movablelimits")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_MOVABLELIMITS;
+  } else if (OperatorTextEquals(aName, aNameEnd, "symmetric")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_SYMMETRIC;
+  } else if (OperatorTextEquals(aName, aNameEnd, "integral")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_INTEGRAL;
+  } else if (OperatorTextEquals(aName, aNameEnd, "mirrorable")) {
+    aOperator.mFlags |= NS_MATHML_OPERATOR_MIRRORABLE;
+  }
+}
+
+// SetOperator: decodes the \uNNNN sequence [aKey, aKeyEnd), then the
+// attributes up to the comment. Returns false if the row is dropped.
+static constexpr bool
+SetParsedOperator(ParsedOperator& aOperator, uint32_t aForm,
+                  const char* aKey, const char* aKeyEnd,
+                  const char* aAttributes, const char* aAttributesEnd,
+                  bool& aTooLong)
+{
+  int32_t i = 0;
+  int32_t len = int32_t(aKeyEnd - aKey);
+  char c = aKey[i++];
+  uint32_t state = 0;
+  char16_t uchar = 0;
+  char16_t units[kMaxPackedOperatorLength] = {};
+  uint32_t length = 0;
+  while (i <= len) {
+    if (0 == state) {
+      if (c != '\\') {
+        return false;
+      }
+      if (i < len) {
+        c = aKey[i];
+      }
+      ++i;
+      if ('u' != c && 'U' != c) {
+        return false;
+      }
+      if (i < len) {
+        c = aKey[i];
+      }
+      ++i;
+      ++state;
+    } else {
+      if ('0' <= c && c <= '9') {
+        uchar = char16_t((uchar << 4) | (c - '0'));
+      } else if ('a' <= c && c <= 'f') {
+        uchar = char16_t((uchar << 4) | (c - 'a' + 0x0a));
+      } else if ('A' <= c && c <= 'F') {
+        uchar = char16_t((uchar << 4) | (c - 'A' + 0x0a));
+      } else {
+        return false;
+      }
+      if (i < len) {
+        c = aKey[i];
+      }
+      ++i;
+      ++state;
+      if (5 == state) {
+        if (length < kMaxPackedOperatorLength) {
+          units[length] = uchar;
+        }
+        ++length;
+        uchar = 0;
+        state = 0;
+      }
+    }
+  }
+  aTooLong = length > kMaxPackedOperatorLength || length > 0xFF;
+  aOperator.mFlags |= aForm;
+  aOperator.mKey = OperatorCompoundKey(units, length);
+  aOperator.mLength = uint8_t(length);
+
+  const char* it = aAttributes;
+  const char* end = aAttributesEnd;
+  while (it != end && '#' != *it) {
+    while (it != end && '#' != *it && *it == ' ') {
+      ++it;
+    }
+    const char* name = it;
+    while (it != end && '#' != *it && *it != ' ' && ':' != *it) {
+      ++it;
+    }
+    const char* nameEnd = it;
+    if (it == end || ':' != *it) {
+      SetParsedBooleanProperty(aOperator, name, nameEnd);
+    } else {
+      ++it;
+      const char* value = it;
+      while (it != end && '#' != *it && *it != ' ') {
+        ++it;
+      }
+      SetParsedProperty(aOperator, name, nameEnd, value, it);
+    }
+    if (it != end) {
+      ++it;
+    }
+  }
+  return true;
+}
+
+// ScanOperatorKey and ParseLines
+template<size_t Count, size_t CompoundCount>
+static constexpr ParsedOperatorTables<Count, CompoundCount>
+ParseOperatorProperties(const char* aText, size_t aLength)
+{
+  ParsedOperatorTables<Count, CompoundCount> tables;
+  const char* line = aText;
+  const char* textEnd = aText + aLength;
+  while (line < textEnd) {
+    const char* lineEnd = line;
+    while (lineEnd != textEnd && *lineEnd != '\n') {
+      ++lineEnd;
+    }
+    const char* next = lineEnd + 1;
+    // CRLF line ends, as in a checkout with core.autocrlf
+    if (lineEnd != line && lineEnd[-1] == '\r') {
+      --lineEnd;
+    }
+
+    const char* prefix = "operator.\\u";
+    const char* keyEnd = line;
+    while (*prefix && keyEnd != lineEnd && *keyEnd == *prefix) {
+      ++keyEnd;
+      ++prefix;
+    }
+    if (!*prefix) {
+      while (keyEnd != lineEnd && !OperatorTextIsSpace(*keyEnd)) {
+        ++keyEnd;
+      }
+    }
+    // 21 is the length of "operator.\uNNNN.infix", the shortest valid key
+    if (!*prefix && keyEnd != lineEnd && *keyEnd == ' ' && keyEnd - line >= 21) {
+      const char* key = line + 9;
+      uint32_t form = 0;
+      const char* keySuffix = keyEnd;
+      if (keyEnd - key > 6 && OperatorTextEquals(keyEnd - 6, keyEnd, ".infix")) {
+        form = NS_MATHML_OPERATOR_FORM_INFIX;
+        keySuffix = keyEnd - 6;
+      } else if (keyEnd - key > 8 && OperatorTextEquals(keyEnd - 8, keyEnd, ".postfix")) {
+        form = NS_MATHML_OPERATOR_FORM_POSTFIX;
+        keySuffix = keyEnd - 8;
+      } else if (keyEnd - key > 7 && OperatorTextEquals(keyEnd - 7, keyEnd, ".prefix")) {
+        form = NS_MATHML_OPERATOR_FORM_PREFIX;
+        keySuffix = keyEnd - 7;
+      }
+      ParsedOperator parsed;
+      bool tooLong = false;
+      if (form && SetParsedOperator(parsed, form, key, keySuffix,
+                                    keyEnd + 1, lineEnd, tooLong)) {
+        if (keySuffix - key > 6) {
+          tables.mCompoundOperators.Append(parsed);
+          tables.mCompoundOperators.mOverflow |= tooLong;
+        } else {
+          tables.mOperators.Append(parsed);
+        }
+      }
+    }
+    line = next;
+  }
+  SortParsedOperators(tables.mOperators);
+  SortParsedOperators(tables.mCompoundOperators);
+  return tables;
+}
+
+// True if aTable, an array of rows with mStr, mLength, mLeadingSpace,
+// mTrailingSpace and mFlags, holds exactly the rows of aParsed
+template<size_t N, typename Row, size_t M>
+static constexpr bool
+ParsedOperatorsMatch(const ParsedOperatorTable<N>& aParsed, const Row (&aTable)[M])
+{
+  if (aParsed.mOverflow || aParsed.mCount != M) {
+    return false;
+  }
+  for (size_t i = 0; i < M; ++i) {
+    const ParsedOperator& parsed = aParsed.mRows[i];
+    if (OperatorCompoundKey(aTable[i].mStr, aTable[i].mLength) != parsed.mKey ||
+        aTable[i].mLength != parsed.mLength ||
+        aTable[i].mLeadingSpace != parsed.mLeadingSpace ||
+        aTable[i].mTrailingSpace != parsed.mTrailingSpace ||
+        aTable[i].mFlags != parsed.mFlags) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#endif /* nsMathMLOperatorParser_h___ */
@@ -65,6 +65,18 @@ public:
   static void ReleaseTable(void);
   static void CleanUp();
 
+  // LoadDictionary:
+  // Maps the binary Operator Dictionary at aPath, written by
+  // GenerateOperatorTable --layout=binary, and searches it in place instead
+  // of the built-in tables until UnloadDictionary or CleanUp. Returns false,
+  // keeping the tables in use, if the file is missing or is not a valid
+  // dictionary of the version this code reads.
+  // Both can be called while other threads look operators up: lookups that
+  // started before see the previous tables, and a replaced dictionary is
+  // unmapped once they are done, before these return.
+  static bool LoadDictionary(const char* aPath);
+  static void UnloadDictionary();
+
   // LookupOperator:
   // Given the string value of an operator and its form (last two bits of flags),
   // this method returns true if the operator is found in the Operator Dictionary.
@@ -80,6 +92,36 @@ public:
                  float*                aLeadingSpace,
                  float*                aTrailingSpace);
 
+  // Same as above, for the aLength UTF-16 code units at aOperator, which
+  // need not be null-terminated. Neither copies nor allocates anything.
+  static bool
+  LookupOperator(const char16_t*       aOperator,
+                 uint32_t              aLength,
+                 const nsOperatorFlags aForm,
+                 nsOperatorFlags*      aFlags,
+                 float*                aLeadingSpace,
+                 float*                aTrailingSpace);
+
+  // LookupOperator<Form>:
+  // Same as LookupOperator, for a form known at compile time, one of
+  // NS_MATHML_OPERATOR_FORM_{INFIX|PREFIX|POSTFIX}. The other forms are
+  // tried in an order fixed for each form, and built with
+  // MATHML_OPERATOR_FORM_TABLES the search compares no forms at all.
+  template<nsOperatorFlags Form>
+  static bool
+  LookupOperator(const nsString&  aOperator,
+                 nsOperatorFlags* aFlags,
+                 float*           aLeadingSpace,
+                 float*           aTrailingSpace);
+
+  template<nsOperatorFlags Form>
+  static bool
+  LookupOperator(const char16_t*  aOperator,
+                 uint32_t         aLength,
+                 nsOperatorFlags* aFlags,
+                 float*           aLeadingSpace,
+                 float*           aTrailingSpace);
+
    // LookupOperators:
    // Helper to return all the forms under which an operator is listed in the
    // Operator Dictionary. The caller must pass arrays of size 4, and use
@@ -93,6 +135,27 @@ public:
                    float*                aLeadingSpace,
                    float*                aTrailingSpace);
 
+  // LookupOperatorBatch:
+  // Looks up the aCount operators of aOperators with their searches
+  // interleaved, so that their cache misses overlap, e.g. for all the <mo>
+  // of an mrow. aForms, aFlags, aLeadingSpace and aTrailingSpace are
+  // arrays of aCount elements used as the arguments of LookupOperator, and
+  // aFound[i] receives what LookupOperator returns for aOperators[i].
+  static void
+  LookupOperatorBatch(const nsString*        aOperators,
+                      const nsOperatorFlags* aForms,
+                      uint32_t               aCount,
+                      nsOperatorFlags*       aFlags,
+                      float*                 aLeadingSpace,
+                      float*                 aTrailingSpace,
+                      bool*                  aFound);
+
+  // GetLookupCacheStats:
+  // Hits and misses of the lookup cache of the calling thread since it
+  // started, both 0 unless built with MATHML_OPERATOR_LOOKUP_CACHE.
+  static void
+  GetLookupCacheStats(uint64_t* aHits, uint64_t* aMisses);
+
   // Helper functions used by the nsMathMLChar class.
   static bool
   IsMirrorableOperator(const nsString& aOperator);